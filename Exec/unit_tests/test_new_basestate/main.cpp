@@ -101,6 +101,42 @@ int main(int argc, char* argv[]) {
         Print() << "subtract in place" << std::endl;
 
         base_state -= other_base_state;
+
+        Print() << "subtract from and divide a scalar" << std::endl;
+
+        BaseState<Real> ramp(nlevs, len, ncomp);
+        BaseStateArray<Real> ramp_arr = ramp.array();
+        for (auto l = 0; l < nlevs; ++l) {
+            AMREX_PARALLEL_FOR_1D(len, n, {
+                for (auto comp = 0; comp < ncomp; ++comp) {
+                    ramp_arr(l, n, comp) = Real(l + n + comp + 2);
+                }
+            });
+        }
+        Gpu::synchronize();
+
+        BaseState<Real> diff_state = 1.0 - ramp;
+        BaseState<Real> quot_state = 1.0 / ramp;
+        const auto diff_arr = diff_state.const_array();
+        const auto quot_arr = quot_state.const_array();
+
+        for (auto l = 0; l < nlevs; ++l) {
+            for (auto n = 0; n < len; ++n) {
+                for (auto comp = 0; comp < ncomp; ++comp) {
+                    const Real x = Real(l + n + comp + 2);
+                    if (diff_arr(l, n, comp) != 1.0 - x ||
+                        quot_arr(l, n, comp) != 1.0 / x) {
+                        Abort("scalar-first operators are wrong at level " +
+                              std::to_string(l) + ", index " +
+                              std::to_string(n) + ", component " +
+                              std::to_string(comp));
+                    }
+                }
+            }
+        }
+
+        Print() << "1.0 - base_state = " << diff_arr(0, 0, 0)
+                << ", 1.0 / base_state = " << quot_arr(0, 0, 0) << std::endl;
     }
 
     // destroy timer for profiling
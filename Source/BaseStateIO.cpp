@@ -0,0 +1,190 @@
+#include <BaseStateIO.H>
+
+#include <AMReX_Utility.H>
+#include <AMReX_VisMF.H>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+using namespace amrex;
+
+namespace {
+
+const std::string magic{"MAESTRO_BASESTATE\n"};
+
+bool IsLittleEndian() {
+    const std::uint16_t one = 1;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+
+// append the bytes of val to buf in little-endian order
+template <class T>
+void Append(std::string& buf, const T val) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &val, sizeof(T));
+    if (!IsLittleEndian()) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    buf.append(bytes, sizeof(T));
+}
+
+// read a little-endian value of type T from buf at pos and advance pos
+template <class T>
+T Extract(const std::string& filename, const Vector<char>& buf,
+          std::size_t& pos, const std::size_t end) {
+    if (pos + sizeof(T) > end) {
+        Abort("BaseStateIO::Read: " + filename + " is truncated");
+    }
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, buf.dataPtr() + pos, sizeof(T));
+    if (!IsLittleEndian()) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    pos += sizeof(T);
+    T val;
+    std::memcpy(&val, bytes, sizeof(T));
+    return val;
+}
+
+// 64-bit FNV-1a
+std::uint64_t Checksum(const char* data, const std::size_t n) {
+    std::uint64_t h = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < n; ++i) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+}  // namespace
+
+void BaseStateIO::Write(const std::string& filename,
+                        const Vector<const BaseState<Real>*>& states) {
+    // timer for profiling
+    BL_PROFILE("BaseStateIO::Write()");
+
+    std::string buf;
+
+    Append<std::int32_t>(buf, version);
+    Append<std::int32_t>(buf, states.size());
+
+    for (const auto* s : states) {
+        Append<std::int32_t>(buf, s->nLevels());
+        Append<std::int32_t>(buf, s->length());
+        Append<std::int32_t>(buf, s->nComp());
+
+        const std::size_t n =
+            std::size_t(s->nLevels()) * s->length() * s->nComp();
+        const Real* data = s->const_array().dataPtr();
+
+        if (IsLittleEndian() && sizeof(Real) == sizeof(double)) {
+            // the usual case, the data is already in the file layout
+            buf.append(reinterpret_cast<const char*>(data),
+                       n * sizeof(double));
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                Append<double>(buf, data[i]);
+            }
+        }
+    }
+
+    const std::uint64_t checksum = Checksum(buf.data(), buf.size());
+
+    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+    std::ofstream File;
+    File.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+    File.open(filename.c_str(), std::ofstream::out | std::ofstream::trunc |
+                                    std::ofstream::binary);
+    if (!File.good()) {
+        amrex::FileOpenFailed(filename);
+    }
+
+    File.write(magic.data(), magic.size());
+    File.write(buf.data(), buf.size());
+
+    std::string tail;
+    Append<std::uint64_t>(tail, checksum);
+    File.write(tail.data(), tail.size());
+
+    File.close();
+    if (!File.good()) {
+        Abort("BaseStateIO::Write: failed to write " + filename);
+    }
+}
+
+bool BaseStateIO::IsBinary(const Vector<char>& buf) {
+    return buf.size() >= magic.size() &&
+           std::memcmp(buf.dataPtr(), magic.data(), magic.size()) == 0;
+}
+
+void BaseStateIO::Read(const std::string& filename, const Vector<char>& buf,
+                       const Vector<BaseState<Real>*>& states) {
+    // timer for profiling
+    BL_PROFILE("BaseStateIO::Read()");
+
+    if (!IsBinary(buf)) {
+        Abort("BaseStateIO::Read: " + filename +
+              " is not a binary base state file");
+    }
+
+    // ReadAndBcastFile appends a null terminator to the contents
+    const std::size_t end = buf.size() - 1;
+
+    const std::size_t begin = magic.size();
+    if (end < begin + sizeof(std::uint64_t)) {
+        Abort("BaseStateIO::Read: " + filename + " is truncated");
+    }
+    const std::size_t data_end = end - sizeof(std::uint64_t);
+
+    // check the checksum before we interpret anything
+    std::size_t pos = data_end;
+    const auto checksum = Extract<std::uint64_t>(filename, buf, pos, end);
+    if (checksum != Checksum(buf.dataPtr() + begin, data_end - begin)) {
+        Abort("BaseStateIO::Read: checksum mismatch in " + filename);
+    }
+
+    pos = begin;
+    const auto file_version =
+        Extract<std::int32_t>(filename, buf, pos, data_end);
+    if (file_version > version) {
+        Abort("BaseStateIO::Read: " + filename + " has version " +
+              std::to_string(file_version) + ", but we only know up to " +
+              std::to_string(version));
+    }
+
+    const auto nstates = Extract<std::int32_t>(filename, buf, pos, data_end);
+    if (nstates != static_cast<std::int32_t>(states.size())) {
+        Abort("BaseStateIO::Read: " + filename + " has " +
+              std::to_string(nstates) + " base states, expected " +
+              std::to_string(states.size()));
+    }
+
+    for (auto* s : states) {
+        const auto nlev = Extract<std::int32_t>(filename, buf, pos, data_end);
+        const auto len = Extract<std::int32_t>(filename, buf, pos, data_end);
+        const auto nvar = Extract<std::int32_t>(filename, buf, pos, data_end);
+
+        if (nlev != s->nLevels() || len != s->length() ||
+            nvar != s->nComp()) {
+            Abort("BaseStateIO::Read: base state in " + filename +
+                  " has a different size than the current run");
+        }
+
+        const std::size_t n = std::size_t(nlev) * len * nvar;
+        Real* data = s->dataPtr();
+
+        if (IsLittleEndian() && sizeof(Real) == sizeof(double)) {
+            if (pos + n * sizeof(double) > data_end) {
+                Abort("BaseStateIO::Read: " + filename + " is truncated");
+            }
+            std::memcpy(data, buf.dataPtr() + pos, n * sizeof(double));
+            pos += n * sizeof(double);
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                data[i] = Extract<double>(filename, buf, pos, data_end);
+            }
+        }
+    }
+}
@@ -81,6 +81,10 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // end spherical-only MultiFabs
     ////////////////////////
 
+    // the MultiFabs above reuse the memory of the last time step's, and go
+    // back into mf_pool when this goes out of scope
+    MultiFabPool::Scope pool(mf_pool, grids_generation);
+
     // vectors store the multilevel 1D states as one very long array
     // these are cell-centered
     BaseState<Real> grav_cell_nph(base_geom.max_radial_level + 1,
@@ -124,66 +128,67 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         // cell-centered MultiFabs
-        rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
-        macrhs[lev].define(grids[lev], dmap[lev], 1, 0);
-        macphi[lev].define(grids[lev], dmap[lev], 1, 1);
-        S_cc_nph[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        thermal1[lev].define(grids[lev], dmap[lev], 1, 0);
-        thermal2[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        s1[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+        pool.define(rhohalf[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(macrhs[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(macphi[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(S_cc_nph[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(rho_omegadot[lev], grids[lev], dmap[lev], NumSpec, 0);
+        pool.define(thermal1[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(thermal2[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(rho_Hnuc[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(rho_Hext[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(s1[lev], grids[lev], dmap[lev], Nscal, ng_s);
         s1[lev].setVal(0.);
-        s2[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2star[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_p_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff1[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff2[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
+        pool.define(s2[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        pool.define(s2star[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        pool.define(delta_gamma1_term[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(delta_gamma1[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(delta_p_term[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(p0_cart[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(Tcoeff[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(hcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(Xkcoeff1[lev], grids[lev], dmap[lev], NumSpec, 1);
+        pool.define(pcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(hcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(Xkcoeff2[lev], grids[lev], dmap[lev], NumSpec, 1);
+        pool.define(pcoeff2[lev], grids[lev], dmap[lev], 1, 1);
         if (ppm_trace_forces == 0) {
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, 1);
+            pool.define(scal_force[lev], grids[lev], dmap[lev], Nscal, 1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+            pool.define(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
         }
-        delta_chi[lev].define(grids[lev], dmap[lev], 1, 0);
-        sponge[lev].define(grids[lev], dmap[lev], 1, 0);
+        pool.define(delta_chi[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(sponge[lev], grids[lev], dmap[lev], 1, 0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(etarhoflux[lev].define(convert(grids[lev], nodal_flag_x),
-                                            dmap[lev], 1, 1);
-                     , etarhoflux[lev].define(convert(grids[lev], nodal_flag_y),
-                                              dmap[lev], 1, 1);
-                     , etarhoflux[lev].define(convert(grids[lev], nodal_flag_z),
-                                              dmap[lev], 1, 1););
+        pool.define(etarhoflux[lev],
+                    convert(grids[lev],
+                            IntVect::TheDimensionVector(AMREX_SPACEDIM - 1)),
+                    dmap[lev], 1, 1);
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-                     , umac[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-                     , umac[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sedge[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sedge[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sflux[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sflux[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
+        AMREX_D_TERM(
+            pool.define(umac[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], 1, 1);
+            , pool.define(umac[lev][1], convert(grids[lev], nodal_flag_y),
+                          dmap[lev], 1, 1);
+            , pool.define(umac[lev][2], convert(grids[lev], nodal_flag_z),
+                          dmap[lev], 1, 1););
+        AMREX_D_TERM(
+            pool.define(sedge[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], Nscal, 0);
+            , pool.define(sedge[lev][1], convert(grids[lev], nodal_flag_y),
+                          dmap[lev], Nscal, 0);
+            , pool.define(sedge[lev][2], convert(grids[lev], nodal_flag_z),
+                          dmap[lev], Nscal, 0););
+        AMREX_D_TERM(
+            pool.define(sflux[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], Nscal, 0);
+            , pool.define(sflux[lev][1], convert(grids[lev], nodal_flag_y),
+                          dmap[lev], Nscal, 0);
+            , pool.define(sflux[lev][2], convert(grids[lev], nodal_flag_z),
+                          dmap[lev], Nscal, 0););
 
         // initialize umac
         for (int d = 0; d < AMREX_SPACEDIM; ++d) {
@@ -192,17 +197,18 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
             sflux[lev][d].setVal(0.);
         }
 
-        w0_force_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        pool.define(w0_force_cart[lev], grids[lev], dmap[lev],
+                    AMREX_SPACEDIM, 1);
     }
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev], 1,
-                             1);
-        w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev], 1,
-                             1);
-        w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev], 1,
-                             1);
+        pool.define(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                    dmap[lev], 1, 1);
     }
 #endif
 
@@ -226,6 +232,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 1 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::react);
+
     react_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -244,6 +252,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 2 -- define average expansion at time n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     advect_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -351,6 +361,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 3 -- construct the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 3 : create MAC velocities >>>" << std::endl;
     }
@@ -378,9 +390,12 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
     macproj_time_start = ParallelDescriptor::second();
 
+    mem_log.beginPhase(MemLog::macproj);
+
     // MAC projection
     // includes spherical option in C++ function
     MacProj(umac, macphi, macrhs, beta0_old, is_predictor);
+    mem_log.endPhase();
 
     macproj_time += ParallelDescriptor::second() - macproj_time_start;
     ParallelDescriptor::ReduceRealMax(macproj_time,
@@ -392,6 +407,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 4 -- advect the base state and full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     advect_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -556,6 +573,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 4a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::thermal);
+
     thermal_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -607,6 +626,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 5 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::react);
+
     react_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -616,6 +637,9 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     React(s2, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_new, 0.5 * dt,
           t_old + 0.5 * dt);
 
+    // evaluate the EOS for snew once, for the routines below that need it
+    MakeEOSCache(snew);
+
     react_time += ParallelDescriptor::second() - react_time_start;
     ParallelDescriptor::ReduceRealMax(react_time,
                                       ParallelDescriptor::IOProcessorNumber());
@@ -655,6 +679,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 6 -- define a new average expansion rate at n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     advect_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -759,6 +785,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 7 -- redo the construction of the advective velocity using the current w0
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 7 : create MAC velocities >>>" << std::endl;
     }
@@ -780,9 +808,12 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
 
     macproj_time_start = ParallelDescriptor::second();
 
+    mem_log.beginPhase(MemLog::macproj);
+
     // MAC projection
     // includes spherical option in C++ function
     MacProj(umac, macphi, macrhs, beta0_nph, is_predictor);
+    mem_log.endPhase();
 
     macproj_time += ParallelDescriptor::second() - macproj_time_start;
     ParallelDescriptor::ReduceRealMax(macproj_time,
@@ -794,6 +825,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 8 -- advect the base state and full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     advect_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -946,6 +979,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 8a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::thermal);
+
     thermal_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -991,6 +1026,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 9 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::react);
+
     react_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -1000,6 +1037,14 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     React(s2, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_new, 0.5 * dt,
           t_old + 0.5 * dt);
 
+    // evaluate the EOS for snew once, for the routines below that need it
+    MakeEOSCache(snew);
+
+    // keep the rates for the diagnostics and plotfiles of snew
+    if (!is_initIter) {
+        CacheReactionRates(rho_Hext, rho_omegadot, rho_Hnuc, t_new);
+    }
+
     react_time += ParallelDescriptor::second() - react_time_start;
     ParallelDescriptor::ReduceRealMax(react_time,
                                       ParallelDescriptor::IOProcessorNumber());
@@ -1035,6 +1080,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 10 -- compute S^{n+1} for the final projection
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     ndproj_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -1077,6 +1124,8 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
     // STEP 11 -- update the velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     advect_time_start = ParallelDescriptor::second();
 
     if (maestro_verbose >= 1) {
@@ -1157,8 +1206,11 @@ void Maestro::AdvanceTimeStep(bool is_initIter) {
         }
     }
 
+    mem_log.beginPhase(MemLog::nodalproj);
+
     // call nodal projection
     NodalProj(proj_type, rhcc_for_nodalproj);
+    mem_log.endPhase();
 
     beta0_nm1.copy(0.5 * (beta0_old + beta0_new));
 
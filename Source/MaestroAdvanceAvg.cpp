@@ -59,6 +59,10 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // end spherical-only MultiFabs
     ////////////////////////
 
+    // the MultiFabs above reuse the memory of the last time step's, and go
+    // back into mf_pool when this goes out of scope
+    MultiFabPool::Scope pool(mf_pool, grids_generation);
+
     // vectors store the multilevel 1D states as one very long array
     // these are cell-centered
     BaseState<Real> grav_cell_nph(base_geom.max_radial_level + 1,
@@ -101,66 +105,66 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         // cell-centered MultiFabs
-        rhohalf[lev].define(grids[lev], dmap[lev], 1, 1);
-        macrhs[lev].define(grids[lev], dmap[lev], 1, 0);
-        macphi[lev].define(grids[lev], dmap[lev], 1, 1);
-        S_cc_nph[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        thermal1[lev].define(grids[lev], dmap[lev], 1, 0);
-        thermal2[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hnuc[lev].define(grids[lev], dmap[lev], 1, 0);
-        rho_Hext[lev].define(grids[lev], dmap[lev], 1, 0);
-        s1[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        s2star[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        delta_p_term[lev].define(grids[lev], dmap[lev], 1, 0);
-        Tcoeff[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff1[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff1[lev].define(grids[lev], dmap[lev], 1, 1);
-        hcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
-        Xkcoeff2[lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff2[lev].define(grids[lev], dmap[lev], 1, 1);
+        pool.define(rhohalf[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(macrhs[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(macphi[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(S_cc_nph[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(rho_omegadot[lev], grids[lev], dmap[lev], NumSpec, 0);
+        pool.define(thermal1[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(thermal2[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(rho_Hnuc[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(rho_Hext[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(s1[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        pool.define(s2[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        pool.define(s2star[lev], grids[lev], dmap[lev], Nscal, ng_s);
+        pool.define(delta_gamma1_term[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(delta_gamma1[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(p0_cart[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(delta_p_term[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(Tcoeff[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(hcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(Xkcoeff1[lev], grids[lev], dmap[lev], NumSpec, 1);
+        pool.define(pcoeff1[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(hcoeff2[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(Xkcoeff2[lev], grids[lev], dmap[lev], NumSpec, 1);
+        pool.define(pcoeff2[lev], grids[lev], dmap[lev], 1, 1);
         if (ppm_trace_forces == 0) {
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, 1);
+            pool.define(scal_force[lev], grids[lev], dmap[lev], Nscal, 1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force[lev].define(grids[lev], dmap[lev], Nscal, ng_s);
+            pool.define(scal_force[lev], grids[lev], dmap[lev], Nscal, ng_s);
         }
-        delta_chi[lev].define(grids[lev], dmap[lev], 1, 0);
-        sponge[lev].define(grids[lev], dmap[lev], 1, 0);
+        pool.define(delta_chi[lev], grids[lev], dmap[lev], 1, 0);
+        pool.define(sponge[lev], grids[lev], dmap[lev], 1, 0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(
-            etarhoflux_dummy[lev].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-            , etarhoflux_dummy[lev].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-            , etarhoflux_dummy[lev].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
+        pool.define(etarhoflux_dummy[lev],
+                    convert(grids[lev],
+                            IntVect::TheDimensionVector(AMREX_SPACEDIM - 1)),
+                    dmap[lev], 1, 1);
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                         dmap[lev], 1, 1);
-                     , umac[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                           dmap[lev], 1, 1);
-                     , umac[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                           dmap[lev], 1, 1););
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sedge[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sedge[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                          dmap[lev], Nscal, 0);
-                     , sflux[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                            dmap[lev], Nscal, 0);
-                     , sflux[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                            dmap[lev], Nscal, 0););
+        AMREX_D_TERM(
+            pool.define(umac[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], 1, 1);
+            , pool.define(umac[lev][1], convert(grids[lev], nodal_flag_y),
+                          dmap[lev], 1, 1);
+            , pool.define(umac[lev][2], convert(grids[lev], nodal_flag_z),
+                          dmap[lev], 1, 1););
+        AMREX_D_TERM(
+            pool.define(sedge[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], Nscal, 0);
+            , pool.define(sedge[lev][1], convert(grids[lev], nodal_flag_y),
+                          dmap[lev], Nscal, 0);
+            , pool.define(sedge[lev][2], convert(grids[lev], nodal_flag_z),
+                          dmap[lev], Nscal, 0););
+        AMREX_D_TERM(
+            pool.define(sflux[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], Nscal, 0);
+            , pool.define(sflux[lev][1], convert(grids[lev], nodal_flag_y),
+                          dmap[lev], Nscal, 0);
+            , pool.define(sflux[lev][2], convert(grids[lev], nodal_flag_z),
+                          dmap[lev], Nscal, 0););
 
         // initialize umac
         for (int d = 0; d < AMREX_SPACEDIM; ++d) {
@@ -170,24 +174,24 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev], 1,
-                             1);
-        w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev], 1,
-                             1);
-        w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev], 1,
-                             1);
-        w0mac_dummy[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev],
-                                   1, 1);
-        w0mac_dummy[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev],
-                                   1, 1);
-        w0mac_dummy[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev],
-                                   1, 1);
+        pool.define(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac_dummy[lev][0], convert(grids[lev], nodal_flag_x),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac_dummy[lev][1], convert(grids[lev], nodal_flag_y),
+                    dmap[lev], 1, 1);
+        pool.define(w0mac_dummy[lev][2], convert(grids[lev], nodal_flag_z),
+                    dmap[lev], 1, 1);
     }
 #endif
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        w0_force_cart_dummy[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM,
-                                        1);
+        pool.define(w0_force_cart_dummy[lev], grids[lev], dmap[lev],
+                    AMREX_SPACEDIM, 1);
         w0_force_cart_dummy[lev].setVal(0.);
     }
 
@@ -224,6 +228,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 1 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::react);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 1 : react state >>>" << std::endl;
     }
@@ -242,6 +248,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 2 -- define average expansion at time n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 2 : compute provisional S >>>" << std::endl;
     }
@@ -305,6 +313,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 3 -- construct the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 3 : create MAC velocities >>>" << std::endl;
     }
@@ -351,9 +361,12 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // wallclock time
     Real start_total_macproj = ParallelDescriptor::second();
 
+    mem_log.beginPhase(MemLog::macproj);
+
     // MAC projection
     // includes spherical option in C++ function
     MacProj(umac, macphi, macrhs, beta0_old, is_predictor);
+    mem_log.endPhase();
 
     // wallclock time
     Real end_total_macproj = ParallelDescriptor::second() - start_total_macproj;
@@ -374,6 +387,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 4 -- advect the full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4 : advect base >>>" << std::endl;
     }
@@ -417,9 +432,10 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     DensityAdvance(1, s1, s2, sedge, sflux, scal_force, etarhoflux_dummy, umac,
                    w0mac_dummy, rho0_pred_edge_dummy);
 
-    // correct the base state density by "averaging"
+    // correct the base state density by "averaging"; s2 is not changed
+    // again until the enthalpy advance, so average rhoh0_new with it
     if (evolve_base_state) {
-        Average(s2, rho0_new, Rho);
+        Average(s2, {&rho0_new, &rhoh0_new}, {Rho, RhoH});
         ComputeCutoffCoords(rho0_new);
     }
 
@@ -448,9 +464,9 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
 
     // base state enthalpy update
     if (evolve_base_state) {
-        // compute rhoh0_old by "averaging"
+        // compute rhoh0_old by "averaging"; rhoh0_new was averaged from s2
+        // with rho0_new above (-> rhoh0_new = rhoh0_old (bad?))
         Average(s1, rhoh0_old, RhoH);
-        Average(s2, rhoh0_new, RhoH);  // -> rhoh0_new = rhoh0_old (bad?)
     } else {
         rhoh0_new.copy(rhoh0_old);
     }
@@ -475,6 +491,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 4a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::thermal);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 4a: thermal conduct >>>" << std::endl;
     }
@@ -510,6 +528,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 5 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::react);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 5 : react state >>>" << std::endl;
     }
@@ -520,6 +540,9 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     React(s2, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_new, 0.5 * dt,
           t_old + 0.5 * dt);
 
+    // evaluate the EOS for snew once, for the routines below that need it
+    MakeEOSCache(snew);
+
     // wallclock time
     end_total_react += ParallelDescriptor::second() - start_total_react;
     ParallelDescriptor::ReduceRealMax(end_total_react,
@@ -542,6 +565,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 6 -- define a new average expansion rate at n+1/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 6 : make new S >>>" << std::endl;
     }
@@ -615,6 +640,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 7 -- redo the construction of the advective velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::predictor);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 7 : create MAC velocities >>>" << std::endl;
     }
@@ -655,9 +682,12 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // wallclock time
     start_total_macproj = ParallelDescriptor::second();
 
+    mem_log.beginPhase(MemLog::macproj);
+
     // MAC projection
     // includes spherical option in C++ function
     MacProj(umac, macphi, macrhs, beta0_nph, is_predictor);
+    mem_log.endPhase();
 
     // wallclock time
     end_total_macproj += ParallelDescriptor::second() - start_total_macproj;
@@ -678,6 +708,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 8 -- advect the full state through dt
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8 : advect base >>>" << std::endl;
     }
@@ -700,9 +732,9 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     DensityAdvance(2, s1, s2, sedge, sflux, scal_force, etarhoflux_dummy, umac,
                    w0mac_dummy, rho0_pred_edge_dummy);
 
-    // correct the base state density by "averaging"
+    // correct the base state density and enthalpy by "averaging"
     if (evolve_base_state) {
-        Average(s2, rho0_new, Rho);
+        Average(s2, {&rho0_new, &rhoh0_new}, {Rho, RhoH});
         ComputeCutoffCoords(rho0_new);
     }
 
@@ -731,11 +763,6 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
         psi.copy((p0_new - p0_old) / dt);
     }
 
-    // base state enthalpy averaging
-    if (evolve_base_state) {
-        Average(s2, rhoh0_new, RhoH);
-    }
-
     // base state enthalpy update
     if (maestro_verbose >= 1) {
         Print() << "            : enthalpy_advance >>>" << std::endl;
@@ -757,6 +784,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 8a (Option I) -- Add thermal conduction (only enthalpy terms)
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::thermal);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 8a: thermal conduct >>>" << std::endl;
     }
@@ -786,6 +815,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 9 -- react the full state and then base state through dt/2
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::react);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 9 : react state >>>" << std::endl;
     }
@@ -796,6 +827,14 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     React(s2, snew, rho_Hext, rho_omegadot, rho_Hnuc, p0_new, 0.5 * dt,
           t_old + 0.5 * dt);
 
+    // evaluate the EOS for snew once, for the routines below that need it
+    MakeEOSCache(snew);
+
+    // keep the rates for the diagnostics and plotfiles of snew
+    if (!is_initIter) {
+        CacheReactionRates(rho_Hext, rho_omegadot, rho_Hnuc, t_new);
+    }
+
     // wallclock time
     end_total_react += ParallelDescriptor::second() - start_total_react;
     ParallelDescriptor::ReduceRealMax(end_total_react,
@@ -813,6 +852,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 10 -- compute S^{n+1} for the final projection
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 10: make new S >>>" << std::endl;
     }
@@ -848,6 +889,8 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // STEP 11 -- update the velocity
     //////////////////////////////////////////////////////////////////////////////
 
+    mem_log.beginPhase(MemLog::advance);
+
     if (maestro_verbose >= 1) {
         Print() << "<<< STEP 11: update and project new velocity >>>"
                 << std::endl;
@@ -938,8 +981,11 @@ void Maestro::AdvanceTimeStepAverage(bool is_initIter) {
     // wallclock time
     const Real start_total_nodalproj = ParallelDescriptor::second();
 
+    mem_log.beginPhase(MemLog::nodalproj);
+
     // call nodal projection
     NodalProj(proj_type, rhcc_for_nodalproj);
+    mem_log.endPhase();
 
     // wallclock time
     Real end_total_nodalproj =
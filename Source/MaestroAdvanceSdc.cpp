@@ -550,8 +550,8 @@ void Maestro::AdvanceTimeStepSDC(bool is_initIter) {
               bcs_s);
 
     if (evolve_base_state) {
-        // update base state density and pressure
-        Average(snew, rho0_new, Rho);
+        // update base state density, enthalpy and pressure
+        Average(snew, {&rho0_new, &rhoh0_new}, {Rho, RhoH});
         ComputeCutoffCoords(rho0_new);
 
         if (use_etarho) {
@@ -570,9 +570,6 @@ void Maestro::AdvanceTimeStepSDC(bool is_initIter) {
         // hold dp0/dt in psi for Make_S_cc
         psi.copy((p0_new - p0_old) / dt);
 
-        // update base state enthalpy
-        Average(snew, rhoh0_new, RhoH);
-
         // compute intra_rhoh0 = (rhoh0_new - rhoh0_old)/dt
         //                       - (rhoh0_hat - rhoh0_old)/dt
         delta_rhoh0.copy((rhoh0_new - rhoh0_old) / dt - delta_rhoh0);
@@ -948,8 +945,8 @@ void Maestro::AdvanceTimeStepSDC(bool is_initIter) {
                   bcs_s);
 
         if (evolve_base_state) {
-            // update base state density and pressure
-            Average(snew, rho0_new, Rho);
+            // update base state density, enthalpy and pressure
+            Average(snew, {&rho0_new, &rhoh0_new}, {Rho, RhoH});
             ComputeCutoffCoords(rho0_new);
 
             if (use_etarho) {
@@ -968,9 +965,6 @@ void Maestro::AdvanceTimeStepSDC(bool is_initIter) {
             // hold dp0/dt in psi for Make_S_cc
             psi.copy((p0_new - p0_old) / dt);
 
-            // also update base state enthalpy
-            Average(snew, rhoh0_new, RhoH);
-
             // compute intra_rhoh0 = (rhoh0_new - rhoh0_old)/dt
             //                       - (rhoh0_hat - rhoh0_old)/dt
             delta_rhoh0.copy((rhoh0_new - rhoh0_old) / dt - delta_rhoh0);
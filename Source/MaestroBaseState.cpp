@@ -17,7 +17,7 @@ void Maestro::InitBaseState(BaseState<Real>& rho0, BaseState<Real>& rhoh0,
 
     if (!input_model.model_initialized) {
         // read model file
-        input_model.ReadFile(model_file);
+        input_model.ReadFile(model_file, model_binary_file);
     }
 
     const int npts_model = input_model.npts_model;
@@ -137,12 +137,13 @@ void Maestro::InitBaseState(BaseState<Real>& rho0, BaseState<Real>& rhoh0,
             s0_init_arr(n, r, Temp) = temp_above_cutoff;
 
         } else {
-            Real d_ambient =
-                input_model.Interpolate(rloc, ModelParser::idens_model);
-            Real t_ambient =
-                input_model.Interpolate(rloc, ModelParser::itemp_model);
-            Real p_ambient =
-                input_model.Interpolate(rloc, ModelParser::ipres_model);
+            // interpolate all of the model variables at rloc at once
+            Array<Real, ModelParser::nvars_model> model_vars;
+            input_model.Interpolate(rloc, model_vars);
+
+            Real d_ambient = model_vars[ModelParser::idens_model];
+            Real t_ambient = model_vars[ModelParser::itemp_model];
+            Real p_ambient = model_vars[ModelParser::ipres_model];
 
             RealVector xn_ambient(NumSpec);
 
@@ -151,8 +152,7 @@ void Maestro::InitBaseState(BaseState<Real>& rho0, BaseState<Real>& rhoh0,
             for (auto comp = 0; comp < NumSpec; ++comp) {
                 xn_ambient[comp] = amrex::max(
                     0.0, amrex::min(
-                             1.0, input_model.Interpolate(
-                                      rloc, ModelParser::ispec_model + comp)));
+                             1.0, model_vars[ModelParser::ispec_model + comp]));
                 sumX += xn_ambient[comp];
             }
 
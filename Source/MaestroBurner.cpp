@@ -1,10 +1,44 @@
 
+#include <AMReX_Scan.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
 
 #ifndef SDC
+namespace {
+
+// layout of the burn cache: the inputs of the last integration of each
+// cell, and the resulting rates per unit mass, dX/dt and de/dt
+namespace BurnCache {
+enum : int {
+    valid = 0,
+    rho,
+    T,
+    X,
+    dXdt = X + NumSpec,
+    dedt = dXdt + NumSpec,
+    ncomp
+};
+}
+
+// remember the inputs and the rates of the burn of cell (i,j,k)
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE void StoreBurn(
+    const Array4<Real>& cache, const int i, const int j, const int k,
+    const Real rho, const Real T, const Real* x_in, const Real* x_out,
+    const Real e, const Real dt) noexcept {
+    cache(i, j, k, BurnCache::valid) = 1.0;
+    cache(i, j, k, BurnCache::rho) = rho;
+    cache(i, j, k, BurnCache::T) = T;
+    for (int n = 0; n < NumSpec; ++n) {
+        cache(i, j, k, BurnCache::X + n) = x_in[n];
+        cache(i, j, k, BurnCache::dXdt + n) = (x_out[n] - x_in[n]) / dt;
+    }
+    cache(i, j, k, BurnCache::dedt) = e / dt;
+}
+
+}  // namespace
+
 void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                      const Vector<MultiFab>& rho_Hext,
                      Vector<MultiFab>& rho_omegadot, Vector<MultiFab>& rho_Hnuc,
@@ -13,198 +47,396 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Burner()", Burner);
 
-    // Put tempbar_init on cart
-    Vector<MultiFab> tempbar_init_cart(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        // until we have burned on these grids, assume every cell costs the same
+        if (burn_cost[lev].boxArray() != grids[lev] ||
+            burn_cost[lev].DistributionMap() != dmap[lev]) {
+            burn_cost[lev].define(grids[lev], dmap[lev], 1, 0);
+            burn_cost[lev].setVal(1.);
+        }
+
+        // the burn cache only holds burns done on the current grids
+        if (burn_cache_tol > 0.0 &&
+            (burn_cache[lev].boxArray() != grids[lev] ||
+             burn_cache[lev].DistributionMap() != dmap[lev])) {
+            burn_cache[lev].define(grids[lev], dmap[lev], BurnCache::ncomp,
+                                   0);
+            burn_cache[lev].setVal(0.);
+        }
+
+        if (!burner_load_balance || ParallelDescriptor::NProcs() == 1) {
+            BurnerLevel(lev, s_in[lev], s_out[lev], rho_Hext[lev],
+                        rho_omegadot[lev], rho_Hnuc[lev], burn_cost[lev],
+                        burn_cache[lev], dt_in);
+            continue;
+        }
 
-    if (spherical) {
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            tempbar_init_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-            tempbar_init_cart[lev].setVal(0.);
+        // distribute the boxes over the ranks according to the cost of
+        // the last burn, then copy the burn to and from that distribution
+        const DistributionMapping burn_dm =
+            DistributionMapping::makeKnapSack(burn_cost[lev]);
+
+        const int nscal = s_in[lev].nComp();
+
+        MultiFab s_in_lb(grids[lev], burn_dm, nscal, 0);
+        MultiFab s_out_lb(grids[lev], burn_dm, nscal, 0);
+        MultiFab rho_Hext_lb(grids[lev], burn_dm, 1, 0);
+        MultiFab rho_omegadot_lb(grids[lev], burn_dm, NumSpec, 0);
+        MultiFab rho_Hnuc_lb(grids[lev], burn_dm, 1, 0);
+        MultiFab burn_cost_lb(grids[lev], burn_dm, 1, 0);
+        MultiFab burn_cache_lb;
+
+        // covered cells are not touched by the burner, so the outputs
+        // are copied in as well
+        s_in_lb.ParallelCopy(s_in[lev], 0, 0, nscal);
+        s_out_lb.ParallelCopy(s_out[lev], 0, 0, nscal);
+        rho_Hext_lb.ParallelCopy(rho_Hext[lev], 0, 0, 1);
+        rho_omegadot_lb.ParallelCopy(rho_omegadot[lev], 0, 0, NumSpec);
+        rho_Hnuc_lb.ParallelCopy(rho_Hnuc[lev], 0, 0, 1);
+        if (burn_cache_tol > 0.0) {
+            burn_cache_lb.define(grids[lev], burn_dm, BurnCache::ncomp, 0);
+            burn_cache_lb.ParallelCopy(burn_cache[lev], 0, 0,
+                                       BurnCache::ncomp);
         }
 
-        if (drive_initial_convection) {
-            Put1dArrayOnCart(tempbar_init, tempbar_init_cart, false, false,
-                             bcs_f, 0);
+        BurnerLevel(lev, s_in_lb, s_out_lb, rho_Hext_lb, rho_omegadot_lb,
+                    rho_Hnuc_lb, burn_cost_lb, burn_cache_lb, dt_in);
+
+        s_out[lev].ParallelCopy(s_out_lb, 0, 0, nscal);
+        rho_omegadot[lev].ParallelCopy(rho_omegadot_lb, 0, 0, NumSpec);
+        rho_Hnuc[lev].ParallelCopy(rho_Hnuc_lb, 0, 0, 1);
+        burn_cost[lev].ParallelCopy(burn_cost_lb, 0, 0, 1);
+        if (burn_cache_tol > 0.0) {
+            burn_cache[lev].ParallelCopy(burn_cache_lb, 0, 0,
+                                         BurnCache::ncomp);
         }
     }
+}
+
+void Maestro::BurnerLevel(const int lev, const MultiFab& s_in,
+                          MultiFab& s_out, const MultiFab& rho_Hext,
+                          MultiFab& rho_omegadot, MultiFab& rho_Hnuc,
+                          MultiFab& burn_cost, MultiFab& burn_cache,
+                          const Real dt_in) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::BurnerLevel()", BurnerLevel);
 
     const auto ispec_threshold = network_spec_index(burner_threshold_species);
 
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        // create mask assuming refinement ratio = 2
-        int finelev = lev + 1;
-        if (lev == finest_level) finelev = finest_level;
+    // create mask assuming refinement ratio = 2
+    const int finelev = amrex::min(lev + 1, finest_level);
 
-        const BoxArray& fba = s_in[finelev].boxArray();
-        const iMultiFab& mask = makeFineMask(s_in[lev], fba, IntVect(2));
+    const BoxArray& fba = grids[finelev];
+    const iMultiFab& mask = makeFineMask(s_in, fba, IntVect(2));
 
-        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel
+    // tempbar_init at the cell centers
+    const auto tempbar_init_cart = MakeBaseStateCartView(lev, tempbar_init);
+
+    // reuse the rates of the last burn of a cell if its inputs are
+    // still within burn_cache_tol.  Networks with auxiliary variables
+    // are always integrated.
+#if NAUX_NET > 0
+    const bool use_burn_cache = false;
+#else
+    const bool use_burn_cache = burn_cache_tol > 0.0;
 #endif
-        for (MFIter mfi(s_in[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            // Get the index space of the valid region
-            const Box& tileBox = mfi.tilebox();
+    const Real cache_tol = burn_cache_tol;
 
-            const bool use_mask = (lev != finest_level);
+    Long nhits = 0;
+    Long nlookups = 0;
 
-            const Array4<const Real> s_in_arr = s_in[lev].array(mfi);
-            const Array4<Real> s_out_arr = s_out[lev].array(mfi);
-            const Array4<const Real> rho_Hext_arr = rho_Hext[lev].array(mfi);
-            const Array4<Real> rho_omegadot_arr = rho_omegadot[lev].array(mfi);
-            const Array4<Real> rho_Hnuc_arr = rho_Hnuc[lev].array(mfi);
-            const auto tempbar_init_arr = tempbar_init.const_array();
-
-            // use a dummy value for non-spherical as tempbar_init_cart is not defined
-            const Array4<const Real> tempbar_cart_arr =
-                spherical ? tempbar_init_cart[lev].array(mfi)
-                          : rho_Hext[lev].array(mfi);
-            const Array4<const int> mask_arr = mask.array(mfi);
-
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                if (use_mask && mask_arr(i, j, k))
-                    return;  // cell is covered by finer cells
+    // the cost of burning a cell varies by orders of magnitude, so on the
+    // CPU the tiles are handed out to the threads dynamically
+    MFItInfo mfi_info;
+    if (Gpu::notInLaunchRegion()) {
+        mfi_info.EnableTiling().SetDynamic(true);
+    }
 
-                auto rho = s_in_arr(i, j, k, Rho);
-                Real x_in[NumSpec];
-                for (int n = 0; n < NumSpec; ++n) {
-                    x_in[n] = s_in_arr(i, j, k, FirstSpec + n) / rho;
+    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : nhits, nlookups)
+#endif
+    for (MFIter mfi(s_in, mfi_info); mfi.isValid(); ++mfi) {
+        // Get the index space of the valid region
+        const Box& tileBox = mfi.tilebox();
+
+        const bool use_mask = (lev != finest_level);
+
+        const Array4<const Real> s_in_arr = s_in.array(mfi);
+        const Array4<Real> s_out_arr = s_out.array(mfi);
+        const Array4<const Real> rho_Hext_arr = rho_Hext.array(mfi);
+        const Array4<Real> rho_omegadot_arr = rho_omegadot.array(mfi);
+        const Array4<Real> rho_Hnuc_arr = rho_Hnuc.array(mfi);
+        const Array4<Real> cost_arr = burn_cost.array(mfi);
+        const Array4<const int> mask_arr = mask.array(mfi);
+        const Array4<Real> cache_arr =
+            use_burn_cache ? burn_cache.array(mfi) : Array4<Real>{};
+
+        // 1 for the cells that need to be integrated, 2 for the cells that
+        // reused a cached burn, 0 otherwise
+        IArrayBox active_fab(tileBox, 1);
+        Elixir e_active = active_fab.elixir();
+        const Array4<int> active = active_fab.array();
+
+        // first pass: find the cells that burn, and update the rest, which
+        // just pass through unchanged apart from the external heating
+        ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            active(i, j, k) = 0;
+
+            if (use_mask && mask_arr(i, j, k)) {
+                cost_arr(i, j, k) = 0.0;
+                return;  // cell is covered by finer cells
+            }
+
+            const auto rho = s_in_arr(i, j, k, Rho);
+            const Real x_test =
+                (ispec_threshold > 0)
+                    ? s_in_arr(i, j, k, FirstSpec + ispec_threshold) / rho
+                    : 0.0;
+
+            // if the threshold species is not in the network, then we burn
+            // normally.  if it is in the network, make sure the mass
+            // fraction is above the cutoff.
+            if ((rho > burning_cutoff_density_lo &&
+                 rho < burning_cutoff_density_hi) &&
+                (ispec_threshold < 0 ||
+                 (ispec_threshold > 0 && x_test > burner_threshold_cutoff))) {
+                active(i, j, k) = 1;
+
+                if (!use_burn_cache ||
+                    cache_arr(i, j, k, BurnCache::valid) == 0.0) {
+                    return;
                 }
-#if NAUX_NET > 0
-                Real aux_in[NumAux];
-                for (int n = 0; n < NumAux; ++n) {
-                    aux_in[n] = s_in_arr(i, j, k, FirstAux + n) / rho;
+
+                // reuse the last burn if rho and T are within a relative
+                // tolerance and the mass fractions within an absolute one
+                // of the inputs it was done with
+                const Real T_in = drive_initial_convection
+                                      ? tempbar_init_cart(i, j, k)
+                                      : s_in_arr(i, j, k, Temp);
+                if (amrex::Math::abs(rho - cache_arr(i, j, k, BurnCache::rho)) >
+                        cache_tol * cache_arr(i, j, k, BurnCache::rho) ||
+                    amrex::Math::abs(T_in - cache_arr(i, j, k, BurnCache::T)) >
+                        cache_tol * cache_arr(i, j, k, BurnCache::T)) {
+                    return;
                 }
-#endif
 
-                Real T_in = 0.0;
-                if (drive_initial_convection) {
-                    if (!spherical) {
-                        auto r = (AMREX_SPACEDIM == 2) ? j : k;
-                        T_in = tempbar_init_arr(lev, r);
-                    } else {
-                        T_in = tempbar_cart_arr(i, j, k);
+                Real x_out[NumSpec];
+                for (int n = 0; n < NumSpec; ++n) {
+                    const Real x_in = s_in_arr(i, j, k, FirstSpec + n) / rho;
+                    if (amrex::Math::abs(x_in -
+                                         cache_arr(i, j, k, BurnCache::X + n)) >
+                        cache_tol) {
+                        return;
+                    }
+                    x_out[n] =
+                        x_in + dt_in * cache_arr(i, j, k, BurnCache::dXdt + n);
+                    if (x_out[n] < 0.0) {
+                        return;
                     }
-                } else {
-                    T_in = s_in_arr(i, j, k, Temp);
                 }
 
-                Real x_test =
-                    (ispec_threshold > 0) ? x_in[ispec_threshold] : 0.0;
+                active(i, j, k) = 2;
+                cost_arr(i, j, k) = 1.0;
 
-                burn_t state_in;
-                burn_t state_out;
+                // the cached rates are per unit mass, so scale them by the
+                // current density
+                s_out_arr(i, j, k, Rho) = s_in_arr(i, j, k, Rho);
+                s_out_arr(i, j, k, Pi) = s_in_arr(i, j, k, Pi);
+                for (int n = 0; n < NumSpec; ++n) {
+                    s_out_arr(i, j, k, FirstSpec + n) = x_out[n] * rho;
+                    rho_omegadot_arr(i, j, k, n) =
+                        rho * cache_arr(i, j, k, BurnCache::dXdt + n);
+                }
+                rho_Hnuc_arr(i, j, k) =
+                    rho * cache_arr(i, j, k, BurnCache::dedt);
 
-                Real x_out[NumSpec];
+                // update the enthalpy -- include the change due to external heating
+                s_out_arr(i, j, k, RhoH) = s_in_arr(i, j, k, RhoH) +
+                                           dt_in * rho_Hnuc_arr(i, j, k) +
+                                           dt_in * rho_Hext_arr(i, j, k);
+                return;
+            }
+
+            cost_arr(i, j, k) = 1.0;
+
+            // pass the density, pi, species and auxiliary variables through
+            s_out_arr(i, j, k, Rho) = s_in_arr(i, j, k, Rho);
+            s_out_arr(i, j, k, Pi) = s_in_arr(i, j, k, Pi);
+            for (int n = 0; n < NumSpec; ++n) {
+                s_out_arr(i, j, k, FirstSpec + n) =
+                    s_in_arr(i, j, k, FirstSpec + n);
+                rho_omegadot_arr(i, j, k, n) = 0.0;
+            }
 #if NAUX_NET > 0
-                Real aux_out[NumAux];
+            for (int n = 0; n < NumAux; ++n) {
+                s_out_arr(i, j, k, FirstAux + n) =
+                    s_in_arr(i, j, k, FirstAux + n);
+            }
 #endif
-                Real rhowdot[NumSpec];
-                Real rhoH = 0.0;
+            rho_Hnuc_arr(i, j, k) = 0.0;
+
+            // update the enthalpy with the external heating
+            s_out_arr(i, j, k, RhoH) =
+                s_in_arr(i, j, k, RhoH) + dt_in * rho_Hext_arr(i, j, k);
+        });
+
+        // compact the burning cells into a list of offsets into the tile
+        const int npts = tileBox.numPts();
+        const int* active_p = active_fab.dataPtr();
+
+        IArrayBox cells_fab(tileBox, 1);
+        Elixir e_cells = cells_fab.elixir();
+        int* cells_p = cells_fab.dataPtr();
+
+        const int nactive = Scan::PrefixSum<int>(
+            npts,
+            [=] AMREX_GPU_DEVICE(int n) -> int { return active_p[n] == 1; },
+            [=] AMREX_GPU_DEVICE(int n, int const& offset) {
+                if (active_p[n] == 1) {
+                    cells_p[offset] = n;
+                }
+            },
+            Scan::Type::exclusive, Scan::retSum);
+
+        if (use_burn_cache) {
+            const int nreused = Reduce::Sum<int>(
+                npts, [=] AMREX_GPU_DEVICE(int n) -> int {
+                    return active_p[n] == 2;
+                });
+            nhits += nreused;
+            nlookups += nreused + nactive;
+        }
 
-                // if the threshold species is not in the network, then we burn
-                // normally.  if it is in the network, make sure the mass
-                // fraction is above the cutoff.
-                if ((rho > burning_cutoff_density_lo &&
-                     rho < burning_cutoff_density_hi) &&
-                    (ispec_threshold < 0 ||
-                     (ispec_threshold > 0 &&
-                      x_test > burner_threshold_cutoff))) {
-                    // Initialize burn state_in and state_out
-                    state_in.e = 0.0;
-                    state_in.rho = rho;
-                    state_in.T = T_in;
-                    for (int n = 0; n < NumSpec; ++n) {
-                        state_in.xn[n] = x_in[n];
-                    }
-#if NAUX_NET > 0
-                    for (int n = 0; n < NumAux; ++n) {
-                        state_in.aux[n] = aux_in[n];
-                    }
-#endif
+        if (nactive == 0) {
+            continue;
+        }
 
-                    // initialize state_out the same as state_in
-                    state_out.e = 0.0;
-                    state_out.rho = rho;
-                    state_out.T = T_in;
-                    for (int n = 0; n < NumSpec; ++n) {
-                        state_out.xn[n] = x_in[n];
-                    }
+        // second pass: integrate the network in the burning cells only
+        const auto lo = amrex::lbound(tileBox);
+        const auto len = amrex::length(tileBox);
+
+        ParallelFor(nactive, [=] AMREX_GPU_DEVICE(int m) {
+            const int cell = cells_p[m];
+            const int i = lo.x + cell % len.x;
+            const int j = lo.y + (cell / len.x) % len.y;
+            const int k = lo.z + cell / (len.x * len.y);
+
+            auto rho = s_in_arr(i, j, k, Rho);
+            Real x_in[NumSpec];
+            for (int n = 0; n < NumSpec; ++n) {
+                x_in[n] = s_in_arr(i, j, k, FirstSpec + n) / rho;
+            }
 #if NAUX_NET > 0
-                    for (int n = 0; n < NumAux; ++n) {
-                        state_out.aux[n] = aux_in[n];
-                    }
+            Real aux_in[NumAux];
+            for (int n = 0; n < NumAux; ++n) {
+                aux_in[n] = s_in_arr(i, j, k, FirstAux + n) / rho;
+            }
 #endif
 
-                    burner(state_out, dt_in);
-
-                    for (int n = 0; n < NumSpec; ++n) {
-                        x_out[n] = state_out.xn[n];
-                        rhowdot[n] = state_out.rho *
-                                     (state_out.xn[n] - state_in.xn[n]) / dt_in;
-                    }
+            Real T_in = 0.0;
+            if (drive_initial_convection) {
+                T_in = tempbar_init_cart(i, j, k);
+            } else {
+                T_in = s_in_arr(i, j, k, Temp);
+            }
+
+            burn_t state_in;
+            burn_t state_out;
+
+            // Initialize burn state_in and state_out
+            state_in.e = 0.0;
+            state_in.rho = rho;
+            state_in.T = T_in;
+            for (int n = 0; n < NumSpec; ++n) {
+                state_in.xn[n] = x_in[n];
+            }
 #if NAUX_NET > 0
-                    for (int n = 0; n < NumAux; ++n) {
-                        aux_out[n] = state_out.aux[n];
-                    }
+            for (int n = 0; n < NumAux; ++n) {
+                state_in.aux[n] = aux_in[n];
+            }
 #endif
-                    rhoH = state_out.rho * (state_out.e - state_in.e) / dt_in;
-                } else {
-                    for (int n = 0; n < NumSpec; ++n) {
-                        x_out[n] = x_in[n];
-                        rhowdot[n] = 0.0;
-                    }
+
+            // initialize state_out the same as state_in
+            state_out.e = 0.0;
+            state_out.rho = rho;
+            state_out.T = T_in;
+            for (int n = 0; n < NumSpec; ++n) {
+                state_out.xn[n] = x_in[n];
+            }
 #if NAUX_NET > 0
-                    for (int n = 0; n < NumAux; ++n) {
-                        aux_out[n] = aux_in[n];
-                    }
+            for (int n = 0; n < NumAux; ++n) {
+                state_out.aux[n] = aux_in[n];
+            }
 #endif
-                }
 
-                // check if sum{X_k} = 1
-                Real sumX = 0.0;
-                for (int n = 0; n < NumSpec; ++n) {
-                    sumX += x_out[n];
-                }
-
-                if (fabs(sumX - 1.0) > reaction_sum_tol) {
+            burner(state_out, dt_in);
+
+            // the number of RHS evaluations measures how hard the
+            // cell was to integrate
+            cost_arr(i, j, k) = 1.0 + Real(state_out.n_rhs);
+
+            if (use_burn_cache) {
+                StoreBurn(cache_arr, i, j, k, rho, T_in, state_in.xn,
+                          state_out.xn, state_out.e, dt_in);
+            }
+
+            Real x_out[NumSpec];
+            Real rhowdot[NumSpec];
+            for (int n = 0; n < NumSpec; ++n) {
+                x_out[n] = state_out.xn[n];
+                rhowdot[n] =
+                    state_out.rho * (state_out.xn[n] - state_in.xn[n]) / dt_in;
+            }
+            const Real rhoH =
+                state_out.rho * (state_out.e - state_in.e) / dt_in;
+
+            // check if sum{X_k} = 1
+            Real sumX = 0.0;
+            for (int n = 0; n < NumSpec; ++n) {
+                sumX += x_out[n];
+            }
+
+            if (fabs(sumX - 1.0) > reaction_sum_tol) {
 #ifndef AMREX_USE_GPU
-                    Abort("ERROR: abundances do not sum to 1");
+                Abort("ERROR: abundances do not sum to 1");
 #endif
-                    for (int n = 0; n < NumSpec; ++n) {
-                        state_out.xn[n] /= sumX;
-                    }
+                for (int n = 0; n < NumSpec; ++n) {
+                    state_out.xn[n] /= sumX;
                 }
+            }
 
-                // pass the density and pi through
-                s_out_arr(i, j, k, Rho) = s_in_arr(i, j, k, Rho);
-                s_out_arr(i, j, k, Pi) = s_in_arr(i, j, k, Pi);
+            // pass the density and pi through
+            s_out_arr(i, j, k, Rho) = s_in_arr(i, j, k, Rho);
+            s_out_arr(i, j, k, Pi) = s_in_arr(i, j, k, Pi);
 
-                // update the species
-                for (int n = 0; n < NumSpec; ++n) {
-                    s_out_arr(i, j, k, FirstSpec + n) = x_out[n] * rho;
-                }
+            // update the species
+            for (int n = 0; n < NumSpec; ++n) {
+                s_out_arr(i, j, k, FirstSpec + n) = x_out[n] * rho;
+            }
 
-                // update the auxiliary variables
+            // update the auxiliary variables
 #if NAUX_NET > 0
-                for (int n = 0; n < NumAux; ++n) {
-                    s_out_arr(i, j, k, FirstAux + n) = aux_out[n] * rho;
-                }
+            for (int n = 0; n < NumAux; ++n) {
+                s_out_arr(i, j, k, FirstAux + n) = state_out.aux[n] * rho;
+            }
 #endif
 
-                // store the energy generation and species create quantities
-                for (int n = 0; n < NumSpec; ++n) {
-                    rho_omegadot_arr(i, j, k, n) = rhowdot[n];
-                }
-                rho_Hnuc_arr(i, j, k) = rhoH;
-
-                // update the enthalpy -- include the change due to external heating
-                s_out_arr(i, j, k, RhoH) = s_in_arr(i, j, k, RhoH) +
-                                           dt_in * rho_Hnuc_arr(i, j, k) +
-                                           dt_in * rho_Hext_arr(i, j, k);
-            });
-        }
+            // store the energy generation and species create quantities
+            for (int n = 0; n < NumSpec; ++n) {
+                rho_omegadot_arr(i, j, k, n) = rhowdot[n];
+            }
+            rho_Hnuc_arr(i, j, k) = rhoH;
+
+            // update the enthalpy -- include the change due to external heating
+            s_out_arr(i, j, k, RhoH) = s_in_arr(i, j, k, RhoH) +
+                                       dt_in * rho_Hnuc_arr(i, j, k) +
+                                       dt_in * rho_Hext_arr(i, j, k);
+        });
     }
+
+    burn_cache_hits += nhits;
+    burn_cache_lookups += nlookups;
 }
 
 #else
@@ -215,18 +447,8 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::BurnerSDC()", BurnerSDC);
 
-    // Put tempbar_init on cart
-    Vector<MultiFab> p0_cart(finest_level + 1);
     const auto ispec_threshold = network_spec_index(burner_threshold_species);
 
-    if (spherical) {
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-            p0_cart[lev].setVal(0.);
-        }
-        Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-    }
-
     for (int lev = 0; lev <= finest_level; ++lev) {
         // create mask assuming refinement ratio = 2
         int finelev = lev + 1;
@@ -235,11 +457,21 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in[lev], fba, IntVect(2));
 
+        // p0 at the cell centers
+        const auto p0_cart = MakeBaseStateCartView(lev, p0);
+
+        // the cost of burning a cell varies by orders of magnitude, so on
+        // the CPU the tiles are handed out to the threads dynamically
+        MFItInfo mfi_info;
+        if (Gpu::notInLaunchRegion()) {
+            mfi_info.EnableTiling().SetDynamic(true);
+        }
+
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(s_in[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        for (MFIter mfi(s_in[lev], mfi_info); mfi.isValid(); ++mfi) {
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
 
@@ -247,24 +479,19 @@ void Maestro::Burner(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
 
             const Array4<const Real> s_in_arr = s_in[lev].array(mfi);
             const Array4<Real> s_out_arr = s_out[lev].array(mfi);
-            const Array4<const Real> p0_cart_arr = p0_cart[lev].array(mfi);
             const Array4<const Real> source_arr = source[lev].array(mfi);
             const Array4<const int> mask_arr = mask.array(mfi);
 
-            const auto p0_arr = p0.const_array();
-
             ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
                 if (use_mask && mask_arr(i, j, k))
                     return;  // cell is covered by finer cells
 
-                auto r = (AMREX_SPACEDIM == 2) ? j : k;
-
                 Real sdc_rhoX[NumSpec];
                 for (int n = 0; n < NumSpec; ++n) {
                     sdc_rhoX[n] = source_arr(i, j, k, FirstSpec + n);
                 }
                 auto sdc_rhoh = source_arr(i, j, k, RhoH);
-                auto sdc_p0 = spherical ? p0_cart_arr(i, j, k) : p0_arr(lev, r);
+                auto sdc_p0 = p0_cart(i, j, k);
 
                 auto rho_in = s_in_arr(i, j, k, Rho);
                 Real rhoX_in[NumSpec];
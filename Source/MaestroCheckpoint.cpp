@@ -1,5 +1,7 @@
 
+#include <AMReX_AsyncOut.H>
 #include <AMReX_VisMF.H>
+#include <BaseStateIO.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
 
@@ -27,6 +29,10 @@ void Maestro::WriteCheckPoint(int step) {
 
     amrex::Print() << "Writing checkpoint " << checkpointname << "\n";
 
+    // with async_io, make sure the previous plotfile or checkpoint is
+    // completely on disk before we start on this one
+    AsyncOut::Finish();
+
     const int nlevels = finest_level + 1;
 
     // ---- prebuild a hierarchy of directories
@@ -94,69 +100,58 @@ void Maestro::WriteCheckPoint(int step) {
         }
     }
 
+    // with async_io, VisMF::AsyncWrite copies the data and a background
+    // thread writes the copy, so we can continue with the next step
+    const auto write_mf = [](const MultiFab& mf, const std::string& name) {
+        if (AsyncOut::UseAsyncOut()) {
+            VisMF::AsyncWrite(mf, name);
+        } else {
+            VisMF::Write(mf, name);
+        }
+    };
+
     // write the MultiFab data to, e.g., chk00010/Level_0/
     for (int lev = 0; lev <= finest_level; ++lev) {
-        VisMF::Write(snew[lev], amrex::MultiFabFileFullPrefix(
-                                    lev, checkpointname, "Level_", "snew"));
-        VisMF::Write(unew[lev], amrex::MultiFabFileFullPrefix(
-                                    lev, checkpointname, "Level_", "unew"));
-        VisMF::Write(gpi[lev], amrex::MultiFabFileFullPrefix(
-                                   lev, checkpointname, "Level_", "gpi"));
-        VisMF::Write(dSdt[lev], amrex::MultiFabFileFullPrefix(
-                                    lev, checkpointname, "Level_", "dSdt"));
-        VisMF::Write(S_cc_new[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname,
-                                                   "Level_", "S_cc_new"));
+        write_mf(snew[lev], amrex::MultiFabFileFullPrefix(
+                                lev, checkpointname, "Level_", "snew"));
+        write_mf(unew[lev], amrex::MultiFabFileFullPrefix(
+                                lev, checkpointname, "Level_", "unew"));
+        write_mf(gpi[lev], amrex::MultiFabFileFullPrefix(lev, checkpointname,
+                                                         "Level_", "gpi"));
+        write_mf(dSdt[lev], amrex::MultiFabFileFullPrefix(
+                                lev, checkpointname, "Level_", "dSdt"));
+        write_mf(S_cc_new[lev], amrex::MultiFabFileFullPrefix(
+                                    lev, checkpointname, "Level_", "S_cc_new"));
 #ifdef SDC
-        VisMF::Write(intra[lev], amrex::MultiFabFileFullPrefix(
-                                     lev, checkpointname, "Level_", "intra"));
+        write_mf(intra[lev], amrex::MultiFabFileFullPrefix(
+                                 lev, checkpointname, "Level_", "intra"));
 #endif
     }
 
-    // write out the cell-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
-        std::ofstream BaseCCFile;
-        BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseCCFileName(checkpointname + "/BaseCC");
-        BaseCCFile.open(BaseCCFileName.c_str(), std::ofstream::out |
-                                                    std::ofstream::trunc |
-                                                    std::ofstream::binary);
-        if (!BaseCCFile.good()) {
-            amrex::FileOpenFailed(BaseCCFileName);
-        }
+    // write out the base state in the binary BaseStateIO format. The lambda
+    // holds its own copy of the base state so that with async_io it can be
+    // written in the background.
+    auto write_base_state = [checkpointname, rho0 = rho0_new, p0 = p0_new,
+                             gamma1bar = gamma1bar_new, rhoh0 = rhoh0_new,
+                             beta0 = beta0_new, psi = psi, tempbar = tempbar,
+                             etarho_cc = etarho_cc, tempbar_init = tempbar_init,
+                             p0_old = p0_old, beta0_nm1 = beta0_nm1, w0 = w0,
+                             etarho_ec = etarho_ec]() {
+        // the cell-centered base state
+        BaseStateIO::Write(checkpointname + "/BaseCC",
+                           {&rho0, &p0, &gamma1bar, &rhoh0, &beta0, &psi,
+                            &tempbar, &etarho_cc, &tempbar_init, &p0_old,
+                            &beta0_nm1});
+
+        // the face-centered base state
+        BaseStateIO::Write(checkpointname + "/BaseFC", {&w0, &etarho_ec});
+    };
 
-        BaseCCFile.precision(17);
-
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * base_geom.nr_fine; ++i) {
-            BaseCCFile << rho0_new.array()(i) << " " << p0_new.array()(i) << " "
-                       << gamma1bar_new.array()(i) << " "
-                       << rhoh0_new.array()(i) << " " << beta0_new.array()(i)
-                       << " " << psi.array()(i) << " " << tempbar.array()(i)
-                       << " " << etarho_cc.array()(i) << " "
-                       << tempbar_init.array()(i) << " " << p0_old.array()(i)
-                       << " " << beta0_nm1.array()(i) << "\n";
-        }
-    }
-
-    // write out the face-centered base state
     if (ParallelDescriptor::IOProcessor()) {
-        std::ofstream BaseFCFile;
-        BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseFCFileName(checkpointname + "/BaseFC");
-        BaseFCFile.open(BaseFCFileName.c_str(), std::ofstream::out |
-                                                    std::ofstream::trunc |
-                                                    std::ofstream::binary);
-        if (!BaseFCFile.good()) {
-            amrex::FileOpenFailed(BaseFCFileName);
-        }
-
-        BaseFCFile.precision(17);
-
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * (base_geom.nr_fine + 1);
-             ++i) {
-            BaseFCFile << w0.array()(i) << " " << etarho_ec.array()(i) << "\n";
+        if (AsyncOut::UseAsyncOut()) {
+            AsyncOut::Submit(std::move(write_base_state));
+        } else {
+            write_base_state();
         }
     }
 
@@ -223,6 +218,7 @@ int Maestro::ReadCheckPoint() {
             // set BoxArray grids and DistributionMapping dmap in AMReX_AmrMesh.H class
             SetBoxArray(lev, ba);
             SetDistributionMap(lev, dm);
+            ++grids_generation;
 
             // build MultiFab data
             sold[lev].define(ba, dm, Nscal, ng_s);
@@ -278,36 +274,46 @@ int Maestro::ReadCheckPoint() {
         std::string File(restart_file + "/BaseCC");
         Vector<char> fileCharPtr;
         ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
-        std::string fileCharPtrString(fileCharPtr.dataPtr());
-        std::istringstream is(fileCharPtrString, std::istringstream::in);
 
-        // read in cell-centered base state
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * base_geom.nr_fine; ++i) {
-            std::getline(is, line);
-            std::istringstream lis(line);
-            lis >> word;
-            rho0_old.array()(i) = std::stod(word);
-            lis >> word;
-            p0_old.array()(i) = std::stod(word);
-            lis >> word;
-            gamma1bar_old.array()(i) = std::stod(word);
-            lis >> word;
-            rhoh0_old.array()(i) = std::stod(word);
-            lis >> word;
-            beta0_old.array()(i) = std::stod(word);
-            lis >> word;
-            psi.array()(i) = std::stod(word);
-            lis >> word;
-            tempbar.array()(i) = std::stod(word);
-            lis >> word;
-            etarho_cc.array()(i) = std::stod(word);
-            lis >> word;
-            tempbar_init.array()(i) = std::stod(word);
-            lis >> word;
-            p0_nm1.array()(i) = std::stod(word);
-            lis >> word;
-            beta0_nm1.array()(i) = std::stod(word);
+        if (BaseStateIO::IsBinary(fileCharPtr)) {
+            BaseStateIO::Read(File, fileCharPtr,
+                              {&rho0_old, &p0_old, &gamma1bar_old, &rhoh0_old,
+                               &beta0_old, &psi, &tempbar, &etarho_cc,
+                               &tempbar_init, &p0_nm1, &beta0_nm1});
+        } else {
+            // older checkpoints store the base state as text
+            std::string fileCharPtrString(fileCharPtr.dataPtr());
+            std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+            // read in cell-centered base state
+            for (int i = 0;
+                 i < (base_geom.max_radial_level + 1) * base_geom.nr_fine;
+                 ++i) {
+                std::getline(is, line);
+                std::istringstream lis(line);
+                lis >> word;
+                rho0_old.array()(i) = std::stod(word);
+                lis >> word;
+                p0_old.array()(i) = std::stod(word);
+                lis >> word;
+                gamma1bar_old.array()(i) = std::stod(word);
+                lis >> word;
+                rhoh0_old.array()(i) = std::stod(word);
+                lis >> word;
+                beta0_old.array()(i) = std::stod(word);
+                lis >> word;
+                psi.array()(i) = std::stod(word);
+                lis >> word;
+                tempbar.array()(i) = std::stod(word);
+                lis >> word;
+                etarho_cc.array()(i) = std::stod(word);
+                lis >> word;
+                tempbar_init.array()(i) = std::stod(word);
+                lis >> word;
+                p0_nm1.array()(i) = std::stod(word);
+                lis >> word;
+                beta0_nm1.array()(i) = std::stod(word);
+            }
         }
     }
 
@@ -322,19 +328,25 @@ int Maestro::ReadCheckPoint() {
         std::string File(restart_file + "/BaseFC");
         Vector<char> fileCharPtr;
         ParallelDescriptor::ReadAndBcastFile(File, fileCharPtr);
-        std::string fileCharPtrString(fileCharPtr.dataPtr());
-        std::istringstream is(fileCharPtrString, std::istringstream::in);
 
-        // read in face-centered base state
-        for (int i = 0;
-             i < (base_geom.max_radial_level + 1) * base_geom.nr_fine + 1;
-             ++i) {
-            std::getline(is, line);
-            std::istringstream lis(line);
-            lis >> word;
-            w0.array()(i) = std::stod(word);
-            lis >> word;
-            etarho_ec.array()(i) = std::stod(word);
+        if (BaseStateIO::IsBinary(fileCharPtr)) {
+            BaseStateIO::Read(File, fileCharPtr, {&w0, &etarho_ec});
+        } else {
+            // older checkpoints store the base state as text
+            std::string fileCharPtrString(fileCharPtr.dataPtr());
+            std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+            // read in face-centered base state
+            for (int i = 0;
+                 i < (base_geom.max_radial_level + 1) * base_geom.nr_fine + 1;
+                 ++i) {
+                std::getline(is, line);
+                std::istringstream lis(line);
+                lis >> word;
+                w0.array()(i) = std::stod(word);
+                lis >> word;
+                etarho_ec.array()(i) = std::stod(word);
+            }
         }
     }
 
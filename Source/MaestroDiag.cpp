@@ -25,10 +25,6 @@ void Maestro::DiagFile(const int step, const Real t_in,
     // -- w0mac will contain an edge-centered w0 on a Cartesian grid,
     // -- for use in computing divergences.
     Vector<std::array<MultiFab, AMREX_SPACEDIM> > w0mac(finest_level + 1);
-    // -- w0r_cart is w0 but onto a Cartesian grid in cell-centered as
-    // -- a scalar.  Since w0 is the radial expansion velocity, w0r_cart
-    // -- is the radial w0 in a zone
-    Vector<MultiFab> w0r_cart(finest_level + 1);
 
     // rho_Hnuc and rho_Hext are used to determine energy generation
     Vector<MultiFab> stemp(finest_level + 1);
@@ -51,17 +47,10 @@ void Maestro::DiagFile(const int step, const Real t_in,
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                 w0mac[lev][idim].setVal(0.);
             }
-
-            w0r_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-            w0r_cart[lev].setVal(0.);
         }
 
         // put w0 on Cartesian edges as a vector
         MakeW0mac(w0mac);
-
-        // put w0 in Cartesian cell-centers as a scalar (the radial
-        // expansion velocity)
-        Put1dArrayOnCart(w0, w0r_cart, true, false, bcs_u, 0, 1);
     }
 #endif
 
@@ -77,12 +66,16 @@ void Maestro::DiagFile(const int step, const Real t_in,
     }
 
 #ifndef SDC
-    if (dt < small_dt) {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt,
-              t_in);
-    } else {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt * 0.5,
-              t_in);
+    // reuse the rates from the end of the step if we can, otherwise
+    // react the state again to get them
+    if (!GetCachedReactionRates(t_in, rho_Hext, rho_omegadot, rho_Hnuc)) {
+        if (dt < small_dt) {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in,
+                  small_dt, t_in);
+        } else {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in,
+                  dt * 0.5, t_in);
+        }
     }
 #else
     if (dt < small_dt) {
@@ -140,13 +133,25 @@ void Maestro::DiagFile(const int step, const Real t_in,
         const auto prob_lo = geom[lev].ProbLoArray();
 
         // create mask assuming refinement ratio = 2
+        // in spherical, the radial bin map already holds the mask
         int finelev = lev + 1;
         if (lev == finest_level) {
             finelev = finest_level;
         }
 
-        const BoxArray& fba = s_in[finelev].boxArray();
-        const iMultiFab& mask = makeFineMask(s_in[lev], fba, IntVect(2));
+        iMultiFab fine_mask;
+        if (spherical) {
+            MakeRadialBinMap();
+        } else {
+            const BoxArray& fba = s_in[finelev].boxArray();
+            fine_mask = makeFineMask(s_in[lev], fba, IntVect(2));
+        }
+        const iMultiFab& mask = spherical ? radial_bin_map[lev] : fine_mask;
+        const int mask_comp = spherical ? 1 : 0;
+
+        // reuse the EOS outputs if they were already computed for s_in
+        const MultiFab* eos_cache_lev = EOSCacheFor(s_in, lev);
+        const bool use_cache = eos_cache_lev != nullptr;
 
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -162,9 +167,12 @@ void Maestro::DiagFile(const int step, const Real t_in,
             const auto use_mask = !(lev == finest_level);
 
             const Array4<const Real> scal = s_in[lev].array(mfi);
+            const Array4<const Real> cache_arr =
+                use_cache ? eos_cache_lev->const_array(mfi)
+                          : Array4<const Real>{};
             const Array4<const Real> rho_Hnuc_arr = rho_Hnuc[lev].array(mfi);
             const Array4<const Real> u = u_in[lev].array(mfi);
-            const Array4<const int> mask_arr = mask.array(mfi);
+            const Array4<const int> mask_arr = mask.array(mfi, mask_comp);
             const auto w0_arr = w0.const_array();
 
             // weight is the factor by which the volume of a cell at the current level
@@ -183,8 +191,6 @@ void Maestro::DiagFile(const int step, const Real t_in,
                 spherical ? w0mac[lev][2].array(mfi) : rho_Hnuc[lev].array(mfi);
             const Array4<const Real> normal_arr =
                 spherical ? normal[lev].array(mfi) : rho_Hnuc[lev].array(mfi);
-            const Array4<const Real> w0r =
-                spherical ? w0r_cart[lev].array(mfi) : rho_Hnuc[lev].array(mfi);
 #endif
 
             // The locations of the maxima here make trying to do this on the
@@ -386,7 +392,11 @@ void Maestro::DiagFile(const int step, const Real t_in,
                             }
 #endif
 
-                            eos(eos_input_rt, eos_state);
+                            if (use_cache) {
+                                EOSCache::Load(cache_arr, i, j, k, eos_state);
+                            } else {
+                                eos(eos_input_rt, eos_state);
+                            }
 
                             // kinetic, internal, and nuclear energies
                             kin_ener_level +=
@@ -697,6 +707,20 @@ void Maestro::DiagFile(const int step, const Real t_in,
         }
     }
 
+    // fraction of the burning cells that reused a cached burn since the
+    // last call
+    Real burn_cache_reuse = 0.0;
+    if (burn_cache_tol > 0.0) {
+        Long burn_cache_counts[2] = {burn_cache_hits, burn_cache_lookups};
+        ParallelDescriptor::ReduceLongSum(burn_cache_counts, 2);
+        if (burn_cache_counts[1] > 0) {
+            burn_cache_reuse =
+                Real(burn_cache_counts[0]) / Real(burn_cache_counts[1]);
+        }
+        burn_cache_hits = 0;
+        burn_cache_lookups = 0;
+    }
+
     // write out diagnosis data if at initialization
     if (ParallelDescriptor::IOProcessor()) {
         const std::string& diagfilename1 = "diag_temp.out";
@@ -708,7 +732,8 @@ void Maestro::DiagFile(const int step, const Real t_in,
 
         // num of variables in the outfile depends on geometry but not dimension
         const int ndiag1 = (spherical) ? 11 : 8;
-        const int ndiag2 = (spherical) ? 11 : 9;
+        const int ndiag2 =
+            ((spherical) ? 11 : 9) + ((burn_cache_tol > 0.0) ? 1 : 0);
         const int ndiag3 = (spherical) ? 10 : 7;
 
         if (step == 0) {
@@ -786,7 +811,12 @@ void Maestro::DiagFile(const int step, const Real t_in,
                 diagfile2 << std::setw(setwVal) << std::left << "vr(max{enuc})";
             }
             diagfile2 << std::setw(setwVal) << std::left
-                      << "tot nuc ener(erg/s)" << std::endl;
+                      << "tot nuc ener(erg/s)";
+            if (burn_cache_tol > 0.0) {
+                diagfile2 << std::setw(setwVal) << std::left
+                          << "burn cache reuse";
+            }
+            diagfile2 << std::endl;
 
             // write data
             diagfile2.precision(outfilePrecision);
@@ -812,8 +842,12 @@ void Maestro::DiagFile(const int step, const Real t_in,
                 diagfile2 << std::setw(setwVal) << std::left << Rloc_enucmax;
                 diagfile2 << std::setw(setwVal) << std::left << vr_enucmax;
             }
-            diagfile2 << std::setw(setwVal) << std::left << nuc_ener
-                      << std::endl;
+            diagfile2 << std::setw(setwVal) << std::left << nuc_ener;
+            if (burn_cache_tol > 0.0) {
+                diagfile2 << std::setw(setwVal) << std::left
+                          << burn_cache_reuse;
+            }
+            diagfile2 << std::endl;
 
             // close file
             diagfile2.close();
@@ -894,9 +928,15 @@ void Maestro::DiagFile(const int step, const Real t_in,
             diagfile2_data[index * ndiag2 + 5] = vel_enucmax[0];
             diagfile2_data[index * ndiag2 + 6] = vel_enuc_y;
             diagfile2_data[index * ndiag2 + 7] = vel_enuc_z;
-            diagfile2_data[index * ndiag2 + 8] = Rloc_enucmax;
-            diagfile2_data[index * ndiag2 + 9] = vr_enucmax;
-            diagfile2_data[index * ndiag2 + 10] = nuc_ener;
+            int ienuc = 8;
+            if (spherical) {
+                diagfile2_data[index * ndiag2 + ienuc++] = Rloc_enucmax;
+                diagfile2_data[index * ndiag2 + ienuc++] = vr_enucmax;
+            }
+            diagfile2_data[index * ndiag2 + ienuc++] = nuc_ener;
+            if (burn_cache_tol > 0.0) {
+                diagfile2_data[index * ndiag2 + ienuc] = burn_cache_reuse;
+            }
 
             // vel
             diagfile3_data[index * ndiag3] = t_in;
@@ -922,7 +962,8 @@ void Maestro::DiagFile(const int step, const Real t_in,
 void Maestro::WriteDiagFile(int& index) {
     // num of variables in the outfile depends on geometry but not dimension
     const int ndiag1 = (spherical) ? 11 : 8;
-    const int ndiag2 = (spherical) ? 11 : 9;
+    const int ndiag2 =
+        ((spherical) ? 11 : 9) + ((burn_cache_tol > 0.0) ? 1 : 0);
     const int ndiag3 = (spherical) ? 10 : 7;
 
     // timer for profiling
@@ -967,6 +1008,7 @@ void Maestro::WriteDiagFile(int& index) {
         // -- Rloc_enucmax
         // -- vr_enucmax
         // nuc_ener
+        // burn cache reuse (if burn_cache_tol > 0)
         diagfile2.precision(outfilePrecision);
         diagfile2 << std::scientific;
         for (auto i = 0; i < index; ++i) {
@@ -9,48 +9,56 @@
 
 using namespace amrex;
 
+namespace {
+
+// An additional dS/dt timestep constraint originally used in nova
+// solve the quadratic equation
+// (rho - rho_min)/(rho dt) = S + (dt/2)*(dS/dt)
+// which is equivalent to
+// (rho/2)*dS/dt*dt^2 + rho*S*dt + (rho_min-rho) = 0
+// which has solution dt = 2.0d0*c/(-b-sqrt(b**2-4.0d0*a*c))
+// dt_max is returned if dS/dt does not limit dt
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE Real DSdtLimitedDt(
+    const Real rho, const Real S_cc, const Real dSdt, const Real dt_max) {
+    const Real rho_min = 1.e-20;
+    if (dSdt > 1.e-20) {
+        const Real a = 0.5 * rho * dSdt;
+        const Real b = rho * S_cc;
+        const Real c = rho_min - rho;
+        return 0.4 * 2.0 * c / (-b - std::sqrt(b * b - 4.0 * a * c));
+    }
+    return dt_max;
+}
+
+}  // namespace
+
 void Maestro::EstDt() {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::EstDt()", EstDt);
 
     dt = 1.e20;
 
-    // build dummy w0_force_cart and set equal to zero
-    Vector<MultiFab> w0_force_cart_dummy(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        w0_force_cart_dummy[lev].define(grids[lev], dmap[lev], 3, 1);
-        w0_force_cart_dummy[lev].setVal(0.);
-    }
-
-    // build a dummy umac and set equal to zero
-    Vector<std::array<MultiFab, AMREX_SPACEDIM> > umac_dummy(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        umac_dummy[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev],
-                                  1, 1);
-        umac_dummy[lev][0].setVal(0.);
-        umac_dummy[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev],
-                                  1, 1);
-        umac_dummy[lev][1].setVal(0.);
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > w0mac(finest_level + 1);
+    Vector<MultiFab> vel_force(finest_level + 1);
 #if (AMREX_SPACEDIM == 3)
-        umac_dummy[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev],
-                                  1, 1);
-        umac_dummy[lev][2].setVal(0.);
+    Vector<MultiFab> gp0_cart(finest_level + 1);
 #endif
-    }
+    Vector<MultiFab> p0_cart(finest_level + 1);
+    Vector<MultiFab> gamma1bar_cart(finest_level + 1);
 
-    // face-centered
-    Vector<std::array<MultiFab, AMREX_SPACEDIM> > w0mac(finest_level + 1);
+    // the temporaries above are checked out of mf_pool
+    MultiFabPool::Scope pool(mf_pool, grids_generation);
 
 #if (AMREX_SPACEDIM == 3)
     if (spherical) {
         // initialize
         for (int lev = 0; lev <= finest_level; ++lev) {
-            w0mac[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev],
-                                 1, 1);
-            w0mac[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev],
-                                 1, 1);
-            w0mac[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev],
-                                 1, 1);
+            pool.define(w0mac[lev][0], convert(grids[lev], nodal_flag_x),
+                        dmap[lev], 1, 1);
+            pool.define(w0mac[lev][1], convert(grids[lev], nodal_flag_y),
+                        dmap[lev], 1, 1);
+            pool.define(w0mac[lev][2], convert(grids[lev], nodal_flag_z),
+                        dmap[lev], 1, 1);
         }
 
         for (int lev = 0; lev <= finest_level; ++lev) {
@@ -67,16 +75,15 @@ void Maestro::EstDt() {
 #endif
 
     // build and compute vel_force
-    Vector<MultiFab> vel_force(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
-        vel_force[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        pool.define(vel_force[lev], grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
         // needed to avoid NaNs in filling corner ghost cells with 2 physical boundaries
         vel_force[lev].setVal(0.);
     }
 
+    // without the utilde force neither umac nor w0_force is needed
     int do_add_utilde_force = 0;
-    MakeVelForce(vel_force, umac_dummy, sold, rho0_old, grav_cell_old,
-                 w0_force_cart_dummy,
+    MakeVelForce(vel_force, {}, sold, rho0_old, grav_cell_old, {},
 #ifdef ROTATION
                  w0mac, false,
 #endif
@@ -84,9 +91,8 @@ void Maestro::EstDt() {
 
 #if (AMREX_SPACEDIM == 3)
     // build and initialize grad_p0 for spherical case
-    Vector<MultiFab> gp0_cart(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
-        gp0_cart[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        pool.define(gp0_cart[lev], grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
         gp0_cart[lev].setVal(0.);
     }
     BaseState<Real> gp0(base_geom.max_radial_level + 1, base_geom.nr_fine + 1);
@@ -100,139 +106,80 @@ void Maestro::EstDt() {
     Put1dArrayOnCart(gp0, gp0_cart, true, true, bcs_f, 0);
 #endif
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-    Vector<MultiFab> gamma1bar_cart(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        gamma1bar_cart[lev].define(grids[lev], dmap[lev], 1, 1);
+        pool.define(p0_cart[lev], grids[lev], dmap[lev], 1, 1);
+        pool.define(gamma1bar_cart[lev], grids[lev], dmap[lev], 1, 1);
     }
 
     Put1dArrayOnCart(p0_old, p0_cart, false, false, bcs_f, 0);
     Put1dArrayOnCart(gamma1bar_old, gamma1bar_cart, false, false, bcs_f, 0);
 
-    Real umax = 0.;
+    const Real rho_min = 1.e-20;
+    const Real eps = 1.e-8;
 
-    Real dt_lev = 1.e50;
-    Real umax_lev = 0.;
+    // dt_lev and -umax_lev of every level on this rank, so a single
+    // ReduceRealMin gives both for all levels
+    Vector<Real> dt_umax(2 * (finest_level + 1));
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        // create a MultiFab which will hold values for reduction
-        // over
-        MultiFab tmp(grids[lev], dmap[lev], 5, 0);
+        const auto dx = geom[lev].CellSizeArray();
+        const auto nr_lev = base_geom.nr(lev);
+
+        // everything the constraints need is gathered in one pass: the
+        // largest speeds (x, y, z, and w0) and forces (x, y, z), and the
+        // smallest divU and dS/dt limited dt
+        ReduceOps<ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpMax,
+                  ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpMin,
+                  ReduceOpMin>
+            reduce_op;
+        ReduceData<Real, Real, Real, Real, Real, Real, Real, Real, Real>
+            reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
 
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
-#pragma omp parallel reduction(min : dt_lev) reduction(max : umax_lev)
+#pragma omp parallel
 #endif
-        {
-            dt_lev = 1.e50;
-            Real dt_grid = 1.e50;
-            Real umax_grid = 0.;
-
-            for (MFIter mfi(uold[lev], TilingIfNotGPU()); mfi.isValid();
-                 ++mfi) {
-                // Get the index space of the valid region
-                const Box& tileBox = mfi.tilebox();
-                const auto dx = geom[lev].CellSizeArray();
-
-                const Array4<const Real> scal_arr = sold[lev].array(mfi);
-                const Array4<const Real> u = uold[lev].array(mfi);
-                const Array4<const Real> S_cc_arr = S_cc_old[lev].array(mfi);
-                const Array4<const Real> dSdt_arr = dSdt[lev].array(mfi);
-                const Array4<const Real> w0_arr = w0_cart[lev].array(mfi);
-                const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
-                const Array4<const Real> gamma1bar_arr =
-                    gamma1bar_cart[lev].array(mfi);
-
-                const Array4<Real> spd = tmp.array(mfi);
-
-                if (!spherical) {
-                    const Real rho_min = 1.e-20;
-                    Real dt_temp = 1.e99;
-                    const Real eps = 1.e-8;
-
-                    Real spdx =
-                        uold[lev][mfi].maxabs<RunOn::Device>(tileBox, 0);
-                    tmp[mfi].setVal<RunOn::Device>(0.0, tileBox, 0, 1);
+        for (MFIter mfi(uold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<const Real> scal_arr = sold[lev].array(mfi);
+            const Array4<const Real> u = uold[lev].array(mfi);
+            const Array4<const Real> S_cc_arr = S_cc_old[lev].array(mfi);
+            const Array4<const Real> dSdt_arr = dSdt[lev].array(mfi);
+            const Array4<const Real> w0_arr = w0_cart[lev].array(mfi);
+            const Array4<const Real> force = vel_force[lev].array(mfi);
+            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const Array4<const Real> gamma1bar_arr =
+                gamma1bar_cart[lev].array(mfi);
+
+            if (!spherical) {
+                reduce_op.eval(
+                    tileBox, reduce_data,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                        // the vertical speed includes w0
+                        const int dm = AMREX_SPACEDIM - 1;
 #if (AMREX_SPACEDIM == 2)
-                    ParallelFor(
-                        tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                            spd(i, j, k, 0) =
-                                u(i, j, k, 1) + 0.5 * (w0_arr(i, j, k, 1) +
-                                                       w0_arr(i, j + 1, k, 1));
-                        });
-                    Real spdy = tmp[mfi].maxabs<RunOn::Device>(tileBox, 0);
-                    Real spdz = 0.0;
+                        const Real w0_cc = 0.5 * (w0_arr(i, j, k, dm) +
+                                                  w0_arr(i, j + 1, k, dm));
+                        const Real spdx = amrex::Math::abs(u(i, j, k, 0));
+                        const Real spdy =
+                            amrex::Math::abs(u(i, j, k, 1) + w0_cc);
+                        const Real spdz = 0.0;
+                        const Real fz = 0.0;
 #else
-                    Real spdy =
-                        uold[lev][mfi].maxabs<RunOn::Device>(tileBox, 1);
-
-                    ParallelFor(
-                        tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                            spd(i, j, k, 0) =
-                                u(i, j, k, 2) + 0.5 * (w0_arr(i, j, k, 2) +
-                                                       w0_arr(i, j, k + 1, 2));
-                        });
-                    Real spdz = tmp[mfi].maxabs<RunOn::Device>(tileBox, 0);
-#endif
-                    Real spdr = w0_cart[lev][mfi].maxabs<RunOn::Device>(
-                        tileBox, AMREX_SPACEDIM - 1);
-
-                    umax_grid = amrex::max(
-                        umax_grid,
-                        amrex::max(spdx,
-                                   amrex::max(spdy, amrex::max(spdz, spdr))));
-
-                    if (spdx > eps) {
-                        dt_temp = amrex::min(dt_temp, dx[0] / spdx);
-                    }
-                    if (spdy > eps) {
-                        dt_temp = amrex::min(dt_temp, dx[1] / spdy);
-                    }
-                    if (spdz > eps) {
-                        dt_temp = amrex::min(dt_temp, dx[2] / spdz);
-                    }
-                    if (spdr > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, dx[AMREX_SPACEDIM - 1] / spdr);
-                    }
-
-                    dt_temp *= cfl;
-
-                    // Limit dt based on forcing terms
-                    Real fx =
-                        vel_force[lev][mfi].maxabs<RunOn::Device>(tileBox, 0);
-                    Real fy =
-                        vel_force[lev][mfi].maxabs<RunOn::Device>(tileBox, 1);
-#if (AMREX_SPACEDIM == 3)
-                    Real fz =
-                        vel_force[lev][mfi].maxabs<RunOn::Device>(tileBox, 2);
-#endif
-
-                    if (fx > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, std::sqrt(2.0 * dx[0] / fx));
-                    }
-                    if (fy > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, std::sqrt(2.0 * dx[1] / fy));
-                    }
-#if (AMREX_SPACEDIM == 3)
-                    if (fz > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, std::sqrt(2.0 * dx[2] / fz));
-                    }
+                        const Real w0_cc = 0.5 * (w0_arr(i, j, k, dm) +
+                                                  w0_arr(i, j, k + 1, dm));
+                        const Real spdx = amrex::Math::abs(u(i, j, k, 0));
+                        const Real spdy = amrex::Math::abs(u(i, j, k, 1));
+                        const Real spdz =
+                            amrex::Math::abs(u(i, j, k, 2) + w0_cc);
+                        const Real fz = amrex::Math::abs(force(i, j, k, 2));
 #endif
+                        const Real spdr = amrex::Math::abs(w0_arr(i, j, k, dm));
 
-                    dt_grid = amrex::min(dt_grid, dt_temp);
-
-                    const auto nr_lev = base_geom.nr(lev);
-
-                    tmp[mfi].setVal<RunOn::Device>(1.e99, tileBox, 1, 1);
-
-                    // divU constraint
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
+                        // divU constraint
                         Real gradp0 = 0.0;
 #if (AMREX_SPACEDIM == 2)
                         if (j == 0) {
@@ -247,203 +194,149 @@ void Maestro::EstDt() {
                                 (p0_arr(i, j + 1, k) - p0_arr(i, j - 1, k)) /
                                 dx[1];
                         }
-#else 
+#else
                         if (k == 0) {
-                            gradp0 = (p0_arr(i,j,k+1) - p0_arr(i,j,k)) / dx[2];
-                        } else if (k == nr_lev-1) {
-                            gradp0 = (p0_arr(i,j,k) - p0_arr(i,j,k-1)) / dx[2];
+                            gradp0 =
+                                (p0_arr(i, j, k + 1) - p0_arr(i, j, k)) / dx[2];
+                        } else if (k == nr_lev - 1) {
+                            gradp0 =
+                                (p0_arr(i, j, k) - p0_arr(i, j, k - 1)) / dx[2];
                         } else {
-                            gradp0 = 0.5 * (p0_arr(i,j,k+1) - p0_arr(i,j,k-1)) / dx[2];
+                            gradp0 =
+                                0.5 *
+                                (p0_arr(i, j, k + 1) - p0_arr(i, j, k - 1)) /
+                                dx[2];
                         }
 #endif
-                        Real denom =
+                        const Real denom =
                             S_cc_arr(i, j, k) -
-                            u(i, j, k, AMREX_SPACEDIM - 1) * gradp0 /
+                            u(i, j, k, dm) * gradp0 /
                                 (gamma1bar_arr(i, j, k) * p0_arr(i, j, k));
 
+                        Real dt_divu = 1.e99;
                         if (denom > 0.0 &&
                             rho_min / scal_arr(i, j, k, Rho) < 1.0) {
-                            spd(i, j, k, 1) =
-                                0.4 * (1.0 - rho_min / scal_arr(i, j, k, Rho)) /
-                                denom;
+                            dt_divu = 0.4 *
+                                      (1.0 - rho_min / scal_arr(i, j, k, Rho)) /
+                                      denom;
                         }
-                    });
 
-                    dt_temp = tmp[mfi].min<RunOn::Device>(tileBox, 1);
-
-                    dt_grid = amrex::min(dt_grid, dt_temp);
-
-                    tmp[mfi].setVal<RunOn::Device>(1.e99, tileBox, 2, 1);
-
-                    // An additional dS/dt timestep constraint originally
-                    // used in nova
-                    // solve the quadratic equation
-                    // (rho - rho_min)/(rho dt) = S + (dt/2)*(dS/dt)
-                    // which is equivalent to
-                    // (rho/2)*dS/dt*dt^2 + rho*S*dt + (rho_min-rho) = 0
-                    // which has solution dt = 2.0d0*c/(-b-sqrt(b**2-4.0d0*a*c))
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        if (dSdt_arr(i, j, k) > 1.e-20) {
-                            auto a = 0.5 * scal_arr(i, j, k, Rho) *
-                                     dSdt_arr(i, j, k);
-                            auto b = scal_arr(i, j, k, Rho) * S_cc_arr(i, j, k);
-                            auto c = rho_min - scal_arr(i, j, k, Rho);
-                            spd(i, j, k, 2) =
-                                0.4 * 2.0 * c /
-                                (-b - std::sqrt(b * b - 4.0 * a * c));
-                        }
+                        return {spdx,
+                                spdy,
+                                spdz,
+                                spdr,
+                                amrex::Math::abs(force(i, j, k, 0)),
+                                amrex::Math::abs(force(i, j, k, 1)),
+                                fz,
+                                dt_divu,
+                                DSdtLimitedDt(scal_arr(i, j, k, Rho),
+                                              S_cc_arr(i, j, k),
+                                              dSdt_arr(i, j, k), 1.e99)};
                     });
-
-                    dt_temp = tmp[mfi].min<RunOn::Device>(tileBox, 2);
-
-                    dt_grid = amrex::min(dt_grid, dt_temp);
-                } else {
+            } else {
 #if (AMREX_SPACEDIM == 3)
-
-                    const Array4<const Real> w0macx = w0mac[lev][0].array(mfi);
-                    const Array4<const Real> w0macy = w0mac[lev][1].array(mfi);
-                    const Array4<const Real> w0macz = w0mac[lev][2].array(mfi);
-                    const Array4<const Real> gp0_arr = gp0_cart[lev].array(mfi);
-
-                    const Real rho_min = 1.e-20;
-                    Real dt_temp = 1.e99;
-                    const Real eps = 1.e-8;
-
-                    tmp[mfi].setVal<RunOn::Device>(0.0, tileBox, 0, 3);
-
-                    ParallelFor(
-                        tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                            spd(i, j, k, 0) =
-                                u(i, j, k, 0) +
-                                0.5 * (w0macx(i, j, k) + w0macx(i + 1, j, k));
-                        });
-                    Real spdx = tmp[mfi].maxabs<RunOn::Device>(tileBox, 0);
-
-                    ParallelFor(
-                        tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                            spd(i, j, k, 1) =
-                                u(i, j, k, 1) +
-                                0.5 * (w0macy(i, j, k) + w0macy(i, j + 1, k));
-                        });
-                    Real spdy = tmp[mfi].maxabs<RunOn::Device>(tileBox, 1);
-
-                    ParallelFor(
-                        tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                            spd(i, j, k, 2) =
-                                u(i, j, k, 2) +
-                                0.5 * (w0macz(i, j, k) + w0macz(i, j, k + 1));
-                        });
-                    Real spdz = tmp[mfi].maxabs<RunOn::Device>(tileBox, 2);
-                    Real spdr =
-                        w0_cart[lev][mfi].maxabs<RunOn::Device>(tileBox, 0);
-
-                    umax_grid = amrex::max(
-                        umax_grid,
-                        amrex::max(spdx,
-                                   amrex::max(spdy, amrex::max(spdz, spdr))));
-
-                    if (spdx > eps) {
-                        dt_temp = amrex::min(dt_temp, dx[0] / spdx);
-                    }
-                    if (spdy > eps) {
-                        dt_temp = amrex::min(dt_temp, dx[1] / spdy);
-                    }
-                    if (spdz > eps) {
-                        dt_temp = amrex::min(dt_temp, dx[2] / spdz);
-                    }
-                    if (spdr > eps) {
-                        dt_temp = amrex::min(dt_temp, base_geom.dr(0) / spdr);
-                    }
-
-                    dt_temp *= cfl;
-
-                    // Limit dt based on forcing terms
-                    Real fx =
-                        vel_force[lev][mfi].maxabs<RunOn::Device>(tileBox, 0);
-                    Real fy =
-                        vel_force[lev][mfi].maxabs<RunOn::Device>(tileBox, 1);
-                    Real fz =
-                        vel_force[lev][mfi].maxabs<RunOn::Device>(tileBox, 2);
-
-                    if (fx > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, std::sqrt(2.0 * dx[0] / fx));
-                    }
-                    if (fy > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, std::sqrt(2.0 * dx[1] / fy));
-                    }
-                    if (fz > eps) {
-                        dt_temp =
-                            amrex::min(dt_temp, std::sqrt(2.0 * dx[2] / fz));
-                    }
-
-                    dt_grid = amrex::min(dt_grid, dt_temp);
-
-                    tmp[mfi].setVal<RunOn::Device>(1.e50, tileBox, 3, 2);
-
-                    // divU constraint
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
+                const Array4<const Real> w0macx = w0mac[lev][0].array(mfi);
+                const Array4<const Real> w0macy = w0mac[lev][1].array(mfi);
+                const Array4<const Real> w0macz = w0mac[lev][2].array(mfi);
+                const Array4<const Real> gp0_arr = gp0_cart[lev].array(mfi);
+
+                reduce_op.eval(
+                    tileBox, reduce_data,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                        const Real spdx = amrex::Math::abs(
+                            u(i, j, k, 0) +
+                            0.5 * (w0macx(i, j, k) + w0macx(i + 1, j, k)));
+                        const Real spdy = amrex::Math::abs(
+                            u(i, j, k, 1) +
+                            0.5 * (w0macy(i, j, k) + w0macy(i, j + 1, k)));
+                        const Real spdz = amrex::Math::abs(
+                            u(i, j, k, 2) +
+                            0.5 * (w0macz(i, j, k) + w0macz(i, j, k + 1)));
+
+                        // divU constraint
                         Real gp_dot_u = 0.0;
                         for (auto n = 0; n < AMREX_SPACEDIM; ++n) {
                             gp_dot_u += u(i, j, k, n) * gp0_arr(i, j, k, n);
                         }
 
-                        Real denom = S_cc_arr(i, j, k) - gp_dot_u;
+                        const Real denom = S_cc_arr(i, j, k) - gp_dot_u;
 
+                        Real dt_divu = 1.e50;
                         if (denom > 0.0) {
-                            spd(i, j, k, 3) =
-                                0.4 * (1.0 - rho_min / scal_arr(i, j, k, Rho)) /
-                                denom;
+                            dt_divu = 0.4 *
+                                      (1.0 - rho_min / scal_arr(i, j, k, Rho)) /
+                                      denom;
                         }
-                    });
 
-                    dt_temp = tmp[mfi].min<RunOn::Device>(tileBox, 3);
-
-                    dt_grid = amrex::min(dt_grid, dt_temp);
-
-                    // An additional dS/dt timestep constraint originally
-                    // used in nova
-                    // solve the quadratic equation
-                    // (rho - rho_min)/(rho dt) = S + (dt/2)*(dS/dt)
-                    // which is equivalent to
-                    // (rho/2)*dS/dt*dt^2 + rho*S*dt + (rho_min-rho) = 0
-                    // which has solution dt = 2.0d0*c/(-b-sqrt(b**2-4.0d0*a*c))
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        if (dSdt_arr(i, j, k) > 1.e-20) {
-                            auto a = 0.5 * scal_arr(i, j, k, Rho) *
-                                     dSdt_arr(i, j, k);
-                            auto b = scal_arr(i, j, k, Rho) * S_cc_arr(i, j, k);
-                            auto c = rho_min - scal_arr(i, j, k, Rho);
-                            spd(i, j, k, 4) =
-                                0.4 * 2.0 * c /
-                                (-b - std::sqrt(b * b - 4.0 * a * c));
-                        }
+                        return {spdx,
+                                spdy,
+                                spdz,
+                                amrex::Math::abs(w0_arr(i, j, k, 0)),
+                                amrex::Math::abs(force(i, j, k, 0)),
+                                amrex::Math::abs(force(i, j, k, 1)),
+                                amrex::Math::abs(force(i, j, k, 2)),
+                                dt_divu,
+                                DSdtLimitedDt(scal_arr(i, j, k, Rho),
+                                              S_cc_arr(i, j, k),
+                                              dSdt_arr(i, j, k), 1.e50)};
                     });
-
-                    dt_temp = tmp[mfi].min<RunOn::Device>(tileBox, 4);
-
-                    dt_grid = amrex::min(dt_grid, dt_temp);
 #else
-                    Abort("EstDt: Spherical is not valid for DIM < 3");
+                Abort("EstDt: Spherical is not valid for DIM < 3");
 #endif
-                }
             }
-            dt_lev = amrex::min(dt_lev, dt_grid);
-            umax_lev = amrex::max(umax_lev, umax_grid);
-        }  //end openmp
+        }
+
+        const auto hv = reduce_data.value(reduce_op);
+        const Real spd[3] = {amrex::get<0>(hv), amrex::get<1>(hv),
+                             amrex::get<2>(hv)};
+        const Real spdr = amrex::get<3>(hv);
+        const Real f[3] = {amrex::get<4>(hv), amrex::get<5>(hv),
+                           amrex::get<6>(hv)};
+
+        Real dt_lev = 1.e99;
+
+        // advective constraint
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            if (spd[n] > eps) {
+                dt_lev = amrex::min(dt_lev, dx[n] / spd[n]);
+            }
+        }
+        if (spdr > eps) {
+            const Real dr =
+                spherical ? base_geom.dr(0) : dx[AMREX_SPACEDIM - 1];
+            dt_lev = amrex::min(dt_lev, dr / spdr);
+        }
 
-        // find the smallest dt over all processors
-        ParallelDescriptor::ReduceRealMin(dt_lev);
+        dt_lev *= cfl;
 
-        // find the largest umax over all processors
-        ParallelDescriptor::ReduceRealMax(umax_lev);
+        // Limit dt based on forcing terms
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            if (f[n] > eps) {
+                dt_lev = amrex::min(dt_lev, std::sqrt(2.0 * dx[n] / f[n]));
+            }
+        }
+
+        // divU and dS/dt constraints
+        dt_lev = amrex::min(dt_lev, amrex::get<7>(hv));
+        dt_lev = amrex::min(dt_lev, amrex::get<8>(hv));
+
+        dt_umax[2 * lev] = dt_lev;
+        dt_umax[2 * lev + 1] =
+            -amrex::max(amrex::max(spd[0], spd[1]), amrex::max(spd[2], spdr));
+    }  // end loop over levels
+
+    // find the smallest dt and largest umax at every level over all
+    // processors in one reduction
+    ParallelDescriptor::ReduceRealMin(dt_umax.dataPtr(),
+                                      2 * (finest_level + 1));
+
+    Real umax = 0.;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        const Real dt_lev = dt_umax[2 * lev];
 
         // update umax over all levels
-        umax = amrex::max(umax, umax_lev);
+        umax = amrex::max(umax, -dt_umax[2 * lev + 1]);
 
         if (maestro_verbose > 0) {
             Print() << "Call to estdt for level " << lev
@@ -452,7 +345,7 @@ void Maestro::EstDt() {
 
         // update dt over all levels
         dt = amrex::min(dt, dt_lev);
-    }  // end loop over levels
+    }
 
     if (maestro_verbose > 0) {
         Print() << "Minimum estdt over all levels = " << dt << std::endl;
@@ -488,29 +381,6 @@ void Maestro::FirstDt() {
 
     dt = 1.e20;
 
-    // build dummy w0_force_cart and set equal to zero
-    Vector<MultiFab> w0_force_cart_dummy(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        w0_force_cart_dummy[lev].define(grids[lev], dmap[lev], 3, 1);
-        w0_force_cart_dummy[lev].setVal(0.);
-    }
-
-    // build a dummy umac and set equal to zero
-    Vector<std::array<MultiFab, AMREX_SPACEDIM> > umac_dummy(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        umac_dummy[lev][0].define(convert(grids[lev], nodal_flag_x), dmap[lev],
-                                  1, 1);
-        umac_dummy[lev][0].setVal(0.);
-        umac_dummy[lev][1].define(convert(grids[lev], nodal_flag_y), dmap[lev],
-                                  1, 1);
-        umac_dummy[lev][1].setVal(0.);
-#if (AMREX_SPACEDIM == 3)
-        umac_dummy[lev][2].define(convert(grids[lev], nodal_flag_z), dmap[lev],
-                                  1, 1);
-        umac_dummy[lev][2].setVal(0.);
-#endif
-    }
-
     // build and compute vel_force
     Vector<MultiFab> vel_force(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -545,8 +415,7 @@ void Maestro::FirstDt() {
 #endif
 
     int do_add_utilde_force = 0;
-    MakeVelForce(vel_force, umac_dummy, sold, rho0_old, grav_cell_old,
-                 w0_force_cart_dummy,
+    MakeVelForce(vel_force, {}, sold, rho0_old, grav_cell_old, {},
 #ifdef ROTATION
                  w0mac, false,
 #endif
@@ -580,7 +449,9 @@ void Maestro::FirstDt() {
     Put1dArrayOnCart(p0_old, p0_cart, false, false, bcs_f, 0);
     Put1dArrayOnCart(gamma1bar_old, gamma1bar_cart, false, false, bcs_f, 0);
 
-    Real umax = 0.;
+    // dt_lev and -umax_lev of every level on this rank, so a single
+    // ReduceRealMin gives both for all levels
+    Vector<Real> dt_umax(2 * (finest_level + 1));
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         Real dt_lev = 1.e99;
@@ -797,14 +668,22 @@ void Maestro::FirstDt() {
             umax_lev = amrex::max(umax_lev, umax_grid);
         }  //end openmp
 
-        // find the smallest dt over all processors
-        ParallelDescriptor::ReduceRealMin(dt_lev);
+        dt_umax[2 * lev] = dt_lev;
+        dt_umax[2 * lev + 1] = -umax_lev;
+    }  // end loop over levels
+
+    // find the smallest dt and largest umax at every level over all
+    // processors in one reduction
+    ParallelDescriptor::ReduceRealMin(dt_umax.dataPtr(),
+                                      2 * (finest_level + 1));
+
+    Real umax = 0.;
 
-        // find the largest umax over all processors
-        ParallelDescriptor::ReduceRealMax(umax_lev);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        Real dt_lev = dt_umax[2 * lev];
 
         // update umax over all levels
-        umax = amrex::max(umax, umax_lev);
+        umax = amrex::max(umax, -dt_umax[2 * lev + 1]);
 
         if (maestro_verbose > 0) {
             Print() << "Call to firstdt for level " << lev
@@ -1,4 +1,5 @@
 
+#include <AMReX_AsyncOut.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
 
@@ -19,13 +20,23 @@ void Maestro::Evolve() {
     // index for diag array buffer
     int diag_index = 0;
 
+    // don't count the initialization in the first time step's timers
+    phase_timer.reset();
+
     for (istep = start_step; ((istep <= max_step || max_step < 0) &&
                               (t_old < stop_time || stop_time < 0.0));
          ++istep) {
+        // record the memory use of each phase of this step
+        if (!mem_log_file.empty()) {
+            mem_log.beginStep(istep);
+        }
+
         // check to see if we need to regrid, then regrid
         if (max_level > 0 && regrid_int > 0 && (istep - 1) % regrid_int == 0 &&
             istep != 1) {
+            mem_log.beginPhase(MemLog::regrid);
             Regrid();
+            mem_log.endPhase();
         }
 
         dtold = dt;
@@ -78,17 +89,20 @@ void Maestro::Evolve() {
         Real start_total = ParallelDescriptor::second();
 
         // advance the solution by dt
+        {
+            PhaseTimer::Scope step_scope(phase_timer, PhaseTimer::step);
 #ifdef SDC
-        AdvanceTimeStepSDC(false);
+            AdvanceTimeStepSDC(false);
 #else
-        if (use_exact_base_state || average_base_state) {
-            // new temporal algorithm
-            AdvanceTimeStepAverage(false);
-        } else {
-            // original temporal algorithm
-            AdvanceTimeStep(false);
-        }
+            if (use_exact_base_state || average_base_state) {
+                // new temporal algorithm
+                AdvanceTimeStepAverage(false);
+            } else {
+                // original temporal algorithm
+                AdvanceTimeStep(false);
+            }
 #endif
+        }
 
         t_old = t_new;
 
@@ -97,9 +111,13 @@ void Maestro::Evolve() {
             ((sum_interval > 0 || sum_per > 0) && t_old >= stop_time)) {
             Real diag_start_total = ParallelDescriptor::second();
 
+            mem_log.beginPhase(MemLog::diag);
+
             // save diag output into buffer
             DiagFile(istep, t_new, rho0_new, p0_new, unew, snew, diag_index);
 
+            mem_log.endPhase();
+
             // wallclock time
             Real diag_end_total =
                 ParallelDescriptor::second() - diag_start_total;
@@ -121,8 +139,10 @@ void Maestro::Evolve() {
              (istep == max_step || t_old >= stop_time))) {
             // write a plotfile
             Print() << "\nWriting plotfile " << istep << std::endl;
+            mem_log.beginPhase(MemLog::plot);
             WritePlotFile(istep, t_new, dt, rho0_new, rhoh0_new, p0_new,
                           gamma1bar_new, unew, snew, S_cc_new);
+            mem_log.endPhase();
         }
 
         if ((small_plot_int > 0 && istep % small_plot_int == 0) ||
@@ -132,8 +152,10 @@ void Maestro::Evolve() {
              (istep == max_step || t_old >= stop_time))) {
             // write a small plotfile
             Print() << "\nWriting small plotfile " << istep << std::endl;
+            mem_log.beginPhase(MemLog::plot);
             WriteSmallPlotFile(istep, t_new, dt, rho0_new, rhoh0_new, p0_new,
                                gamma1bar_new, unew, snew, S_cc_new);
+            mem_log.endPhase();
         }
 
         if ((chk_int > 0 && istep % chk_int == 0) ||
@@ -142,7 +164,9 @@ void Maestro::Evolve() {
              (istep == max_step || t_old >= stop_time))) {
             // write a checkpoint file
             Print() << "\nWriting checkpoint " << istep << std::endl;
+            mem_log.beginPhase(MemLog::checkpoint);
             WriteCheckPoint(istep);
+            mem_log.endPhase();
         }
 
         if ((diag_index == diag_buf_size || istep == max_step ||
@@ -152,6 +176,15 @@ void Maestro::Evolve() {
             WriteDiagFile(diag_index);
         }
 
+        // write out the memory use and timers of this step
+        mem_log.endStep(mem_log_file);
+        if (!timing_file.empty()) {
+            phase_timer.endStep(timing_file, istep, t_new, dt);
+        }
+
+        // the EOS cache refers to snew, which is about to become sold
+        InvalidateEOSCache();
+
         // move new state into old state by swapping pointers
         for (int lev = 0; lev <= finest_level; ++lev) {
             std::swap(sold[lev], snew[lev]);
@@ -168,4 +201,9 @@ void Maestro::Evolve() {
         gamma1bar_old.swap(gamma1bar_new);
         grav_cell_old.swap(grav_cell_new);
     }
+
+    // with async_io, wait for the last plotfile and checkpoint to be written
+    AsyncOut::Finish();
+
+    mem_log.printSummary();
 }
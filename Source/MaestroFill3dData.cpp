@@ -15,6 +15,7 @@ void Maestro::Put1dArrayOnCart(const BaseState<Real>& s0,
                                const int variable_type) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Put1dArrayOnCart()", Put1dArrayOnCart);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::put1d);
 
     int ng = s0_cart[0].nGrow();
     if (ng > 0 && bcs.empty()) {
@@ -54,17 +55,14 @@ void Maestro::Put1dArrayOnCart(const int lev, const BaseState<Real>& s0,
                                const Vector<BCRec>& bcs, const int sbccomp) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Put1dArrayOnCart_lev()", Put1dArrayOnCart);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::put1d);
 
-    const auto dx = geom[lev].CellSizeArray();
-    const auto prob_lo = geom[lev].ProbLoArray();
-    const auto& center_p = center;
+    const auto s0_view =
+        MakeBaseStateCartView(lev, s0, is_input_edge_centered);
 
-    const auto& r_edge_loc = base_geom.r_edge_loc;
-    const auto& r_cc_loc = base_geom.r_cc_loc;
-    const auto s0_arr = s0.const_array();
-
-    const int nr_fine = base_geom.nr_fine;
-    const int w0_interp_type_loc = w0_interp_type;
+    const bool vector_sphr = is_output_a_vector && spherical;
+    const int outcomp =
+        (is_output_a_vector && !spherical) ? AMREX_SPACEDIM - 1 : 0;
 
     // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -76,283 +74,53 @@ void Maestro::Put1dArrayOnCart(const int lev, const BaseState<Real>& s0,
 
         const Array4<Real> s0_cart_arr = s0_cart.array(mfi);
 
-        if (!spherical) {
-            const int outcomp = is_output_a_vector ? AMREX_SPACEDIM - 1 : 0;
-
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                const int r = AMREX_SPACEDIM == 2 ? j : k;
-
-                s0_cart_arr(i, j, k, outcomp) =
-                    is_input_edge_centered
-                        ? 0.5 * (s0_arr(lev, r) + s0_arr(lev, r + 1))
-                        : s0_arr(lev, r);
-            });
-
-        } else {
-            const Array4<const int> cc_to_r = cell_cc_to_r[lev].array(mfi);
-
-            if (use_exact_base_state) {
-                if (is_input_edge_centered) {
-                    // we implemented three different ideas for computing s0_cart,
-                    // where s0 is edge-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        int index = cc_to_r(i, j, k);
-
-                        Real rfac;
-                        if (index < nr_fine) {
-                            rfac =
-                                (radius - r_edge_loc(0, index + 1)) /
-                                (r_cc_loc(0, index + 1) - r_cc_loc(0, index));
-                        } else {
-                            rfac =
-                                (radius - r_edge_loc(0, index + 1)) /
-                                (r_cc_loc(0, index) - r_cc_loc(0, index - 1));
-                        }
-
-                        Real s0_cart_val = 0.0;
-
-                        if (w0_interp_type_loc == 1) {
-                            s0_cart_val = rfac > 0.5 ? s0_arr(0, index + 1)
-                                                     : s0_arr(0, index);
-
-                        } else if (w0_interp_type_loc == 2) {
-                            if (index < nr_fine) {
-                                s0_cart_val = rfac * s0_arr(0, index + 1) +
-                                              (1.0 - rfac) * s0_arr(0, index);
-                            } else {
-                                s0_cart_val = s0_arr(0, nr_fine);
-                            }
-
-                        } else if (w0_interp_type_loc == 3) {
-                            if (index <= 0) {
-                                index = 0;
-                            } else if (index >= nr_fine - 1) {
-                                index = nr_fine - 2;
-                            } else if (radius - r_edge_loc(0, index) <
-                                       r_edge_loc(0, index + 1)) {
-                                index--;
-                            }
-
-                            s0_cart_val = QuadInterp(
-                                radius, r_edge_loc(0, index),
-                                r_edge_loc(0, index + 1),
-                                r_edge_loc(0, index + 2), s0_arr(0, index),
-                                s0_arr(0, index + 1), s0_arr(0, index + 2));
-                        }
-
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
-
-                } else {  // is_input_edge_centered = 0
-                    // we directly inject the spherical values into each cell center
-                    // because s0 is also bin-centered.
-
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        int index = cc_to_r(i, j, k);
-
-                        Real s0_cart_val = s0_arr(0, index);
-
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
-                }  // is_input_edge_centered
-
-            } else {  // use_exact_base_state = 0
-
-                const Real drf = base_geom.dr_fine;
-
-                if (is_input_edge_centered) {
-                    // we implemented three different ideas for computing s0_cart,
-                    // where s0 is edge-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-
-                        auto index = int(radius / drf);
-                        Real rfac = (radius - Real(index) * drf) / drf;
-                        Real s0_cart_val = 0.0;
-
-                        if (w0_interp_type_loc == 1) {
-                            s0_cart_val = rfac > 0.5 ? s0_arr(0, index + 1)
-                                                     : s0_arr(0, index);
-
-                        } else if (w0_interp_type_loc == 2) {
-                            if (index < nr_fine) {
-                                s0_cart_val = rfac * s0_arr(0, index + 1) +
-                                              (1.0 - rfac) * s0_arr(0, index);
-                            } else {
-                                s0_cart_val = s0_arr(0, nr_fine);
-                            }
-
-                        } else if (w0_interp_type_loc == 3) {
-                            if (index <= 0) {
-                                index = 0;
-                            } else if (index >= nr_fine - 1) {
-                                index = nr_fine - 2;
-                            } else if (radius - r_edge_loc(0, index) <
-                                       r_edge_loc(0, index + 1)) {
-                                index--;
-                            }
-
-                            s0_cart_val = QuadInterp(
-                                radius, r_edge_loc(0, index),
-                                r_edge_loc(0, index + 1),
-                                r_edge_loc(0, index + 2), s0_arr(0, index),
-                                s0_arr(0, index + 1), s0_arr(0, index + 2));
-                        }
-
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
-
-                } else {  // is_input_edge_centered = 0
-
-                    const int s0_interp_type_loc = s0_interp_type;
-
-                    // we currently have three different ideas for computing s0_cart,
-                    // where s0 is bin-centered.
-                    // 1.  Piecewise constant
-                    // 2.  Piecewise linear
-                    // 3.  Quadratic
-                    ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j,
-                                                              int k) {
-                        Real x =
-                            prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                        Real y =
-                            prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                        Real z =
-                            prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                        Real radius = sqrt(x * x + y * y + z * z);
-                        auto index = int(radius / drf);
-
-                        Real s0_cart_val = 0.0;
-
-                        if (s0_interp_type_loc == 1) {
-                            s0_cart_val = s0_arr(0, index);
-
-                        } else if (s0_interp_type_loc == 2) {
-                            if (radius >= r_cc_loc(0, index)) {
-                                if (index >= nr_fine - 1) {
-                                    s0_cart_val = s0_arr(0, nr_fine - 1);
-                                } else {
-                                    s0_cart_val =
-                                        s0_arr(0, index + 1) *
-                                            (radius - r_cc_loc(0, index)) /
-                                            drf +
-                                        s0_arr(0, index) *
-                                            (r_cc_loc(0, index + 1) - radius) /
-                                            drf;
-                                }
-                            } else {
-                                if (index == 0) {
-                                    s0_cart_val = s0_arr(0, index);
-                                } else if (index > nr_fine - 1) {
-                                    s0_cart_val = s0_arr(0, nr_fine - 1);
-                                } else {
-                                    s0_cart_val =
-                                        s0_arr(0, index) *
-                                            (radius - r_cc_loc(0, index - 1)) /
-                                            drf +
-                                        s0_arr(0, index - 1) *
-                                            (r_cc_loc(0, index) - radius) / drf;
-                                }
-                            }
-                        } else if (s0_interp_type_loc == 3) {
-                            if (index == 0) {
-                                index = 1;
-                            } else if (index >= nr_fine - 1) {
-                                index = nr_fine - 2;
-                            }
+        ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const Real s0_cart_val = s0_view(i, j, k);
 
-                            s0_cart_val = QuadInterp(
-                                radius, r_cc_loc(0, index - 1),
-                                r_cc_loc(0, index), r_cc_loc(0, index + 1),
-                                s0_arr(0, index - 1), s0_arr(0, index),
-                                s0_arr(0, index + 1));
-                        }
-
-                        if (is_output_a_vector) {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val * x / radius;
-                            s0_cart_arr(i, j, k, 1) = s0_cart_val * y / radius;
-                            s0_cart_arr(i, j, k, 2) = s0_cart_val * z / radius;
-                        } else {
-                            s0_cart_arr(i, j, k, 0) = s0_cart_val;
-                        }
-                    });
-                }  // is_input_edge_centered
-            }      // use_exact_base_state
-        }
+            if (vector_sphr) {
+                for (auto n = 0; n < AMREX_SPACEDIM; ++n) {
+                    s0_cart_arr(i, j, k, n) =
+                        s0_cart_val * s0_view.normal(i, j, k, n);
+                }
+            } else {
+                s0_cart_arr(i, j, k, outcomp) = s0_cart_val;
+            }
+        });
     }
 }
 
+BaseStateCartView Maestro::MakeBaseStateCartView(
+    const int lev, const BaseState<Real>& s0,
+    const bool is_input_edge_centered) const {
+    BaseStateCartView view;
+
+    view.s0 = s0.const_array();
+    view.r_cc_loc = base_geom.r_cc_loc;
+    view.r_edge_loc = base_geom.r_edge_loc;
+
+    view.dx = geom[lev].CellSizeArray();
+    view.prob_lo = geom[lev].ProbLoArray();
+    view.center = center;
+    view.dx_fine = geom[max_level].CellSize(0);
+    view.drf = base_geom.dr_fine;
+
+    view.lev = lev;
+    view.nr_fine = base_geom.nr_fine;
+    view.r_hi = spherical ? base_geom.nr_fine - 1 : base_geom.nr(lev) - 1;
+    view.spherical = spherical;
+    view.use_exact_base_state = use_exact_base_state;
+    view.is_input_edge_centered = is_input_edge_centered;
+    view.s0_interp_type = s0_interp_type;
+    view.w0_interp_type = w0_interp_type;
+
+    return view;
+}
+
 AMREX_GPU_DEVICE
 Real Maestro::QuadInterp(const Real x, const Real x0, const Real x1,
                          const Real x2, const Real y0, const Real y1,
                          const Real y2, bool limit) {
-    Real y = y0 + (y1 - y0) / (x1 - x0) * (x - x0) +
-             ((y2 - y1) / (x2 - x1) - (y1 - y0) / (x1 - x0)) / (x2 - x0) *
-                 (x - x0) * (x - x1);
-
-    if (limit) {
-        if (y > amrex::max(y0, amrex::max(y1, y2))) {
-            y = amrex::max(y0, amrex::max(y1, y2));
-        }
-        if (y < amrex::min(y0, amrex::min(y1, y2))) {
-            y = amrex::min(y0, amrex::min(y1, y2));
-        }
-    }
-
-    return y;
+    return BaseStateCartView::QuadInterp(x, x0, x1, x2, y0, y1, y2, limit);
 }
 
 void Maestro::Addw0(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& u_edge,
@@ -1351,5 +1119,9 @@ void Maestro::MakeCCtoRadii() {
             InitBaseStateMapSphr(lev, mfi, dx_fine, dx);
         }
     }
+
+    // the radial bins used by Average are copied from cell_cc_to_r
+    // for irregular base state spacing
+    radial_bin_map_valid = false;
 }
 #endif
@@ -17,6 +17,21 @@ void Maestro::MakeVelForce(
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeVelForce()", MakeVelForce);
 
+    // uedge_in is only read for the utilde force (and the Coriolis term of
+    // the final update), and an empty w0_force_cart means w0_force = 0, so
+    // callers that need neither can pass empty Vectors
+    const bool have_uedge = !uedge_in.empty();
+    const bool have_w0_force = !w0_force_cart.empty();
+
+    if (do_add_utilde_force && !have_uedge) {
+        Abort("MakeVelForce: the utilde force needs uedge_in");
+    }
+#ifdef ROTATION
+    if (is_final_update && !have_uedge) {
+        Abort("MakeVelForce: the final Coriolis term needs uedge_in");
+    }
+#endif
+
     Vector<MultiFab> gradw0_cart(finest_level + 1);
     Vector<MultiFab> grav_cart(finest_level + 1);
     Vector<MultiFab> rho0_cart(finest_level + 1);
@@ -74,14 +89,19 @@ void Maestro::MakeVelForce(
             // Get Array4 inputs
             const Array4<const Real> gpi_arr = gpi[lev].array(mfi);
             const Array4<const Real> rho_arr = rho[lev].array(mfi);
-            const Array4<const Real> uedge = uedge_in[lev][0].array(mfi);
-            const Array4<const Real> vedge = uedge_in[lev][1].array(mfi);
+            const Array4<const Real> uedge =
+                have_uedge ? uedge_in[lev][0].array(mfi) : Array4<const Real>{};
+            const Array4<const Real> vedge =
+                have_uedge ? uedge_in[lev][1].array(mfi) : Array4<const Real>{};
 #if (AMREX_SPACEDIM == 3)
-            const Array4<const Real> wedge = uedge_in[lev][2].array(mfi);
+            const Array4<const Real> wedge =
+                have_uedge ? uedge_in[lev][2].array(mfi) : Array4<const Real>{};
 #endif
             const Array4<const Real> w0_arr = w0_cart[lev].array(mfi);
             const Array4<const Real> gradw0_arr = gradw0_cart[lev].array(mfi);
-            const Array4<const Real> w0_force = w0_force_cart[lev].array(mfi);
+            const Array4<const Real> w0_force =
+                have_w0_force ? w0_force_cart[lev].array(mfi)
+                              : Array4<const Real>{};
             const Array4<const Real> grav = grav_cart[lev].array(mfi);
             const Array4<const Real> rho0_arr = rho0_cart[lev].array(mfi);
 
@@ -120,8 +140,11 @@ void Maestro::MakeVelForce(
                     vel_force(i, j, k, AMREX_SPACEDIM - 1) =
                         (rhopert * grav(i, j, k, AMREX_SPACEDIM - 1) -
                          gpi_arr(i, j, k, AMREX_SPACEDIM - 1)) /
-                            rho_arr(i, j, k) -
-                        w0_force(i, j, k, AMREX_SPACEDIM - 1);
+                        rho_arr(i, j, k);
+                    if (have_w0_force) {
+                        vel_force(i, j, k, AMREX_SPACEDIM - 1) -=
+                            w0_force(i, j, k, AMREX_SPACEDIM - 1);
+                    }
 
                     if (do_add_utilde_force) {
 
@@ -217,8 +240,10 @@ void Maestro::MakeVelForce(
                         vel_force(i, j, k, dim) =
                             (rhopert * grav(i, j, k, dim) -
                              gpi_arr(i, j, k, dim)) /
-                                rho_arr(i, j, k) -
-                            w0_force(i, j, k, dim);
+                            rho_arr(i, j, k);
+                        if (have_w0_force) {
+                            vel_force(i, j, k, dim) -= w0_force(i, j, k, dim);
+                        }
                     }
 #ifdef ROTATION
                     for (int dim = 0; dim < AMREX_SPACEDIM; ++dim) {
@@ -1,76 +1,69 @@
-
 #include <Maestro.H>
+#include <MaestroAverage.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
 
-void Maestro::MakeGamma1bar(const Vector<MultiFab>& scal,
-                            BaseState<Real>& gamma1bar,
-                            const BaseState<Real>& p0) {
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::MakeGamma1bar()", MakeGamma1bar);
+namespace {
 
-    Vector<MultiFab> gamma1(finest_level + 1);
-    Vector<MultiFab> p0_cart(finest_level + 1);
+// gamma1 = gamma1(rho, p0, X) in the cells of one tile
+struct Gamma1Eval {
+    Array4<const Real> scal_arr;
+    BaseStateCartView p0_arr;
+    bool use_pprime_in_tfromp;
 
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        gamma1[lev].define(grids[lev], dmap[lev], 1, 1);
-        gamma1[lev].setVal(0.);
+    AMREX_GPU_HOST_DEVICE Real operator()(int i, int j, int k, int) const {
+        eos_t eos_state;
 
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 1);
-        p0_cart[lev].setVal(0.);
-    }
-
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
-    const auto use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
+        eos_state.rho = scal_arr(i, j, k, Rho);
 
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel
+        if (use_pprime_in_tfromp) {
+            eos_state.p = p0_arr(i, j, k) + scal_arr(i, j, k, Pi);
+        } else {
+            eos_state.p = p0_arr(i, j, k);
+        }
+        eos_state.T = scal_arr(i, j, k, Temp);
+        for (auto n = 0; n < NumSpec; ++n) {
+            eos_state.xn[n] = scal_arr(i, j, k, FirstSpec + n) / eos_state.rho;
+        }
+#if NAUX_NET > 0
+        for (auto n = 0; n < NumAux; ++n) {
+            eos_state.aux[n] = scal_arr(i, j, k, FirstAux + n) / eos_state.rho;
+        }
 #endif
-        for (MFIter mfi(gamma1[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            // Get the index space of the valid region
-            const Box& tileBox = mfi.tilebox();
 
-            const Array4<Real> gamma1_arr = gamma1[lev].array(mfi);
-            const Array4<const Real> scal_arr = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+        // dens, pres, and xmass are inputs
+        eos(eos_input_rp, eos_state);
 
-            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
-                eos_t eos_state;
+        return eos_state.gam1;
+    }
+};
 
-                eos_state.rho = scal_arr(i, j, k, Rho);
+}  // namespace
 
-                if (use_pprime_in_tfromp_loc) {
-                    eos_state.p = p0_arr(i, j, k) + scal_arr(i, j, k, Pi);
-                } else {
-                    eos_state.p = p0_arr(i, j, k);
-                }
-                eos_state.T = scal_arr(i, j, k, Temp);
-                for (auto n = 0; n < NumSpec; ++n) {
-                    eos_state.xn[n] =
-                        scal_arr(i, j, k, FirstSpec + n) / eos_state.rho;
-                }
-#if NAUX_NET > 0
-                for (auto n = 0; n < NumAux; ++n) {
-                    eos_state.aux[n] =
-                        scal_arr(i, j, k, FirstAux + n) / eos_state.rho;
-                }
-#endif
+void Maestro::MakeGamma1bar(const Vector<MultiFab>& scal,
+                            BaseState<Real>& gamma1bar,
+                            const BaseState<Real>& p0) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeGamma1bar()", MakeGamma1bar);
 
-                // dens, pres, and xmass are inputs
-                eos(eos_input_rp, eos_state);
+    const bool use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
 
-                gamma1_arr(i, j, k) = eos_state.gam1;
-            });
-        }
+    // p0 at the cell centers of each level
+    Vector<BaseStateCartView> p0_arr;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        p0_arr.push_back(MakeBaseStateCartView(lev, p0));
     }
 
-    // average fine data onto coarser cells
-    AverageDown(gamma1, 0, 1);
-
-    // call average to create gamma1bar
-    Average(gamma1, gamma1bar, 0);
+    // evaluate gamma1 and add it straight into the radial bins.  Any cells
+    // covered by a finer level are either skipped by the binning or
+    // overwritten when the base state is restricted, so there is no need
+    // to average down first.
+    AverageEval(
+        scal,
+        [&](int lev, const MFIter& mfi) {
+            return Gamma1Eval{scal[lev].const_array(mfi), p0_arr[lev],
+                              use_pprime_in_tfromp_loc};
+        },
+        {&gamma1bar});
 }
@@ -283,6 +283,9 @@ void Maestro::InitData() {
             // set rho0_old = rhoh0_old = 0.
             rho0_old.setVal(0.0);
             rhoh0_old.setVal(0.0);
+
+            // set tempbar to be the average
+            Average(sold, tempbar, Temp);
         } else {
             // set rho0 to be the average
             Average(sold, rho0_old, Rho);
@@ -297,12 +300,10 @@ void Maestro::InitData() {
             // call eos with r,p as input to recompute T,h
             TfromRhoP(sold, p0_old, true);
 
-            // set rhoh0 to be the average
-            Average(sold, rhoh0_old, RhoH);
+            // set rhoh0 and tempbar to be the average
+            Average(sold, {&rhoh0_old, &tempbar}, {RhoH, Temp});
         }
 
-        // set tempbar to be the average
-        Average(sold, tempbar, Temp);
         tempbar_init.copy(tempbar);
     }
 
@@ -326,6 +327,8 @@ void Maestro::MakeNewLevelFromScratch(int lev, Real time, const BoxArray& ba,
     BL_PROFILE_VAR("Maestro::MakeNewLevelFromScratch()",
                    MakeNewLevelFromScratch);
 
+    ++grids_generation;
+
     sold[lev].define(ba, dm, Nscal, ng_s);
     snew[lev].define(ba, dm, Nscal, ng_s);
     uold[lev].define(ba, dm, AMREX_SPACEDIM, ng_s);
@@ -356,6 +359,7 @@ void Maestro::MakeNewLevelFromScratch(int lev, Real time, const BoxArray& ba,
     if (spherical) {
         normal[lev].define(ba, dm, 3, 1);
         cell_cc_to_r[lev].define(ba, dm, 1, 0);
+        radial_bin_map_valid = false;
     }
 
     if (!spherical) {
@@ -15,6 +15,7 @@ void Maestro::MacProj(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
                       const BaseState<Real>& beta0, const bool is_predictor) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MacProj()", MacProj);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::macproj);
 
     // this will hold solver RHS = macrhs - div(beta0*umac)
     Vector<MultiFab> solverrhs(finest_level + 1);
@@ -134,26 +135,47 @@ void Maestro::MacProj(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
 
     // Set up implicit solve using MLABecLaplacian class
     //
-    LPInfo info;
-    info.setMetricTerm(false);
+    // The operator and the MLMG solver only depend on the grids, so we keep
+    // them between calls and rebuild them after the grids change. Only the
+    // boundary values and coefficients are updated for each solve.
+    if (!mac_solver || mac_solver_generation != grids_generation) {
+        LPInfo info;
+        info.setMetricTerm(false);
+
+        if (mg_bottom_solver == 4) {
+            info.setAgglomeration(true);
+            info.setConsolidation(true);
+        } else {
+            info.setAgglomeration(false);
+            info.setConsolidation(false);
+        }
 
-    if (mg_bottom_solver == 4) {
-        info.setAgglomeration(true);
-        info.setConsolidation(true);
-    } else {
-        info.setAgglomeration(false);
-        info.setConsolidation(false);
-    }
+        // the solver refers to the operator, so it has to go first
+        mac_solver.reset();
+
+        // Only pass up to defined level to prevent looping over undefined grids.
+        mac_linop = std::make_unique<MLABecLaplacian>(Geom(0, finest_level),
+                                                      grids, dmap, info);
+
+        // order of stencil
+        int linop_maxorder = 2;
+        mac_linop->setMaxOrder(linop_maxorder);
 
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
+        // set boundaries for mlabec using velocity bc's
+        SetMacSolverBCs(*mac_linop);
 
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
+        // build an MLMG solver
+        mac_solver = std::make_unique<MLMG>(*mac_linop);
 
-    // set boundaries for mlabec using velocity bc's
-    SetMacSolverBCs(mlabec);
+        // set solver parameters
+        mac_solver->setVerbose(mg_verbose);
+        mac_solver->setBottomVerbose(cg_verbose);
+
+        mac_solver_generation = grids_generation;
+    }
+
+    MLABecLaplacian& mlabec = *mac_linop;
+    MLMG& mac_mlmg = *mac_solver;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &macphi[lev]);
@@ -168,22 +190,42 @@ void Maestro::MacProj(Vector<std::array<MultiFab, AMREX_SPACEDIM> >& umac,
 
     // solve -div B grad phi = RHS
 
-    // build an MLMG solver
-    MLMG mac_mlmg(mlabec);
-
-    // set solver parameters
-    mac_mlmg.setVerbose(mg_verbose);
-    mac_mlmg.setBottomVerbose(cg_verbose);
-
     // tolerance parameters taken from original MAESTRO fortran code
     const Real mac_tol_abs = -1.e0;
     const Real mac_tol_rel =
         amrex::min(eps_mac * pow(mac_level_factor, finest_level), eps_mac_max);
 
+    // start the predictor from the solution of the last corrector. Only the
+    // valid region is copied, so the boundary values set above don't change
+    if (is_predictor && warm_start_projections && macphi_warm_valid) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(macphi[lev], macphi_warm[lev], 0, 0, 1, 0);
+        }
+    }
+
     // solve for phi
     mac_mlmg.solve(GetVecOfPtrs(macphi), GetVecOfConstPtrs(solverrhs),
                    mac_tol_rel, mac_tol_abs);
 
+    if (maestro_verbose > 0) {
+        Print() << "MAC projection ("
+                << (is_predictor ? "predictor" : "corrector")
+                << "): " << mac_mlmg.getNumIters()
+                << " MLMG iterations, rel_tol = " << mac_tol_rel << std::endl;
+    }
+
+    // save the corrector solution as the initial guess for the next step
+    if (!is_predictor && warm_start_projections) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            if (macphi_warm[lev].boxArray() != grids[lev] ||
+                macphi_warm[lev].DistributionMap() != dmap[lev]) {
+                macphi_warm[lev].define(grids[lev], dmap[lev], 1, 0);
+            }
+            MultiFab::Copy(macphi_warm[lev], macphi[lev], 0, 0, 1, 0);
+        }
+        macphi_warm_valid = true;
+    }
+
     // update velocity, beta0 * Utilde = beta0 * Utilde^* - B grad phi
 
     // storage for "-B grad_phi"
@@ -13,6 +13,7 @@ void Maestro::MakeEdgeScal(Vector<MultiFab>& state,
                            const bool is_conservative) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScal()", MakeEdgeScal);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::edgescal);
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Get the index space and grid spacing of the domain
@@ -22,273 +23,283 @@ void Maestro::MakeEdgeScal(Vector<MultiFab>& state,
         // get references to the MultiFabs at level lev
         const MultiFab& scal_mf = state[lev];
 
-        MultiFab Ip, Im, Ipf, Imf;
-        Ip.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Im.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Ipf.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imf.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab slx, srx, simhx;
-        slx.define(grids[lev], dmap[lev], 1, 1);
-        srx.define(grids[lev], dmap[lev], 1, 1);
-        simhx.define(grids[lev], dmap[lev], 1, 1);
-
-        MultiFab sly, sry, simhy;
-        sly.define(grids[lev], dmap[lev], 1, 1);
-        sry.define(grids[lev], dmap[lev], 1, 1);
-        simhy.define(grids[lev], dmap[lev], 1, 1);
-
-        slx.setVal(0.);
-        srx.setVal(0.);
-        simhx.setVal(0.);
-        sly.setVal(0.);
-        sry.setVal(0.);
-        simhy.setVal(0.);
-
-#if (AMREX_SPACEDIM == 3)
-
-        MultiFab slopez, divu;
-        slopez.define(grids[lev], dmap[lev], 1, 1);
-        divu.define(grids[lev], dmap[lev], 1, 1);
-
-        MultiFab slz, srz, simhz;
-        slz.define(grids[lev], dmap[lev], 1, 1);
-        srz.define(grids[lev], dmap[lev], 1, 1);
-        simhz.define(grids[lev], dmap[lev], 1, 1);
-
-        MultiFab simhxy, simhxz, simhyx, simhyz, simhzx, simhzy;
-        simhxy.define(grids[lev], dmap[lev], 1, 1);
-        simhxz.define(grids[lev], dmap[lev], 1, 1);
-        simhyx.define(grids[lev], dmap[lev], 1, 1);
-        simhyz.define(grids[lev], dmap[lev], 1, 1);
-        simhzx.define(grids[lev], dmap[lev], 1, 1);
-        simhzy.define(grids[lev], dmap[lev], 1, 1);
-
-        slx.setVal(0.);
-        srx.setVal(0.);
-        simhx.setVal(0.);
-        sly.setVal(0.);
-        sry.setVal(0.);
-        simhy.setVal(0.);
-        slz.setVal(0.);
-        srz.setVal(0.);
-        simhz.setVal(0.);
-
-        simhxy.setVal(0.);
-        simhxz.setVal(0.);
-        simhyx.setVal(0.);
-        simhyz.setVal(0.);
-        simhzx.setVal(0.);
-        simhzy.setVal(0.);
-#endif
+        // All of the components are done tile by tile: the slopes, PPM
+        // profiles and intermediate edge states of the current component
+        // live in a scratch FAB covering the tile plus one ghost cell, so
+        // they stay in cache, and the components are read in place from
+        // state instead of being copied out one MultiFab at a time. Each
+        // thread keeps its scratch FABs from one tile to the next, so on
+        // the CPU they are only reallocated when a tile is larger than the
+        // ones before it (on the GPU the Elixir frees them after the tile).
 
-        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #if (AMREX_SPACEDIM == 2)
 
-        Vector<MultiFab> vec_scal_mf(num_comp);
-        for (int comp = 0; comp < num_comp; ++comp) {
-            vec_scal_mf[comp].define(grids[lev], dmap[lev], 1, scal_mf.nGrow());
+        // components of the tile scratch space
+        constexpr int iIp = 0;
+        constexpr int iIm = iIp + AMREX_SPACEDIM;
+        constexpr int islx = iIm + AMREX_SPACEDIM;
+        constexpr int isrx = islx + 1;
+        constexpr int isly = isrx + 1;
+        constexpr int isry = isly + 1;
+        constexpr int isimhx = isry + 1;
+        constexpr int isimhy = isimhx + 1;
+        constexpr int nscratch = isimhy + 1;
 
-            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp + comp, 0, 1,
-                           scal_mf.nGrow());
-        }
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            // Get the index space of the valid region
-            const Box& tileBox = mfi.tilebox();
-            const Box& obx = amrex::grow(tileBox, 1);
+        {
+            // the scratch space of this thread, reused for each of its tiles
+            FArrayBox scratch;
+            FArrayBox force_scratch;
 
-            // Be careful to pass in comp+1 for fortran indexing
-            for (int scomp = start_scomp; scomp < start_scomp + num_comp;
-                 ++scomp) {
-                int vcomp = scomp - start_scomp;
-                int bccomp = start_bccomp + scomp - start_scomp;
+            for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid();
+                 ++mfi) {
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+                const Box& obx = amrex::grow(tileBox, 1);
 
                 Array4<Real> const scal_arr = state[lev].array(mfi);
+                Array4<Real> const force_arr = force[lev].array(mfi);
 
                 Array4<Real> const umac_arr = umac[lev][0].array(mfi);
                 Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
 
-                Array4<Real> const slx_arr = slx.array(mfi);
-                Array4<Real> const srx_arr = srx.array(mfi);
-                Array4<Real> const sly_arr = sly.array(mfi);
-                Array4<Real> const sry_arr = sry.array(mfi);
-
-                Array4<Real> const simhx_arr = simhx.array(mfi);
-                Array4<Real> const simhy_arr = simhy.array(mfi);
-
-                if (ppm_type == 0) {
-                    // we're going to reuse Ip here as slopex and Im as slopey
-                    // as they have the correct number of ghost zones
-
-                    // x-direction
-                    Slopex(obx, vec_scal_mf[vcomp].array(mfi), Ip.array(mfi),
-                           domainBox, bcs, 1, bccomp);
-
-                    // y-direction
-                    Slopey(obx, vec_scal_mf[vcomp].array(mfi), Im.array(mfi),
-                           domainBox, bcs, 1, bccomp);
-
-                } else {
-                    PPM(obx, scal_arr, umac_arr, vmac_arr, Ip.array(mfi),
-                        Im.array(mfi), domainBox, bcs, dx, true, scomp, bccomp);
+                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
+                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
 
-                    if (ppm_trace_forces == 1) {
-                        PPM(obx, force[lev].array(mfi), umac_arr, vmac_arr,
-                            Ipf.array(mfi), Imf.array(mfi), domainBox, bcs, dx,
-                            true, scomp, bccomp);
-                    }
+                scratch.resize(obx, nscratch);
+                Elixir e_scratch = scratch.elixir();
+                scratch.setVal<RunOn::Device>(0.);
+
+                const auto scratch_arr = scratch.array();
+
+                Array4<Real> const Ip_arr(scratch_arr, iIp);
+                Array4<Real> const Im_arr(scratch_arr, iIm);
+
+                Array4<Real> const slx_arr(scratch_arr, islx);
+                Array4<Real> const srx_arr(scratch_arr, isrx);
+                Array4<Real> const sly_arr(scratch_arr, isly);
+                Array4<Real> const sry_arr(scratch_arr, isry);
+
+                Array4<Real> const simhx_arr(scratch_arr, isimhx);
+                Array4<Real> const simhy_arr(scratch_arr, isimhy);
+
+                // the traced forces are only needed with ppm_trace_forces
+                Elixir e_force_scratch;
+                Array4<Real> Ipf_arr;
+                Array4<Real> Imf_arr;
+                if (ppm_trace_forces == 1) {
+                    force_scratch.resize(obx, 2 * AMREX_SPACEDIM);
+                    e_force_scratch = force_scratch.elixir();
+                    Ipf_arr = Array4<Real>(force_scratch.array(), 0);
+                    Imf_arr =
+                        Array4<Real>(force_scratch.array(), AMREX_SPACEDIM);
                 }
 
-                Gpu::synchronize();
+                for (int scomp = start_scomp; scomp < start_scomp + num_comp;
+                     ++scomp) {
+                    int bccomp = start_bccomp + scomp - start_scomp;
 
-                // Create s_{\i-\half\e_x}^x, etc.
+                    if (ppm_type == 0) {
+                        // we're going to reuse Ip here as slopex and Im as
+                        // slopey as they have the correct number of ghost
+                        // zones
+                        Array4<Real> const s_arr(scal_arr, scomp);
 
-                MakeEdgeScalPredictor(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, scal_arr,
-                    Ip.array(mfi), Im.array(mfi), umac_arr, vmac_arr, simhx_arr,
-                    simhy_arr, domainBox, bcs, dx, scomp, bccomp, is_vel);
+                        // x-direction
+                        Slopex(obx, s_arr, Ip_arr, domainBox, bcs, 1, bccomp);
 
-                Gpu::synchronize();
+                        // y-direction
+                        Slopey(obx, s_arr, Im_arr, domainBox, bcs, 1, bccomp);
 
-                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
-                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
+                    } else {
+                        PPM(obx, scal_arr, umac_arr, vmac_arr, Ip_arr, Im_arr,
+                            domainBox, bcs, dx, true, scomp, bccomp);
 
-                // Create sedgelx, etc.
+                        if (ppm_trace_forces == 1) {
+                            PPM(obx, force_arr, umac_arr, vmac_arr, Ipf_arr,
+                                Imf_arr, domainBox, bcs, dx, true, scomp,
+                                bccomp);
+                        }
+                    }
 
-                MakeEdgeScalEdges(mfi, slx_arr, srx_arr, sly_arr, sry_arr,
-                                  scal_arr, sedgex_arr, sedgey_arr,
-                                  force[lev].array(mfi), umac_arr, vmac_arr,
-                                  Ipf.array(mfi), Imf.array(mfi), simhx_arr,
-                                  simhy_arr, domainBox, bcs, dx, scomp, bccomp,
-                                  is_vel, is_conservative);
-            }  // end loop over components
-        }      // end MFIter loop
+                    // Create s_{\i-\half\e_x}^x, etc.
 
-#elif (AMREX_SPACEDIM == 3)
+                    MakeEdgeScalPredictor(mfi, slx_arr, srx_arr, sly_arr,
+                                          sry_arr, scal_arr, Ip_arr, Im_arr,
+                                          umac_arr, vmac_arr, simhx_arr,
+                                          simhy_arr, domainBox, bcs, dx, scomp,
+                                          bccomp, is_vel);
 
-        Vector<MultiFab> vec_scal_mf(num_comp);
-        for (int comp = 0; comp < num_comp; ++comp) {
-            vec_scal_mf[comp].define(grids[lev], dmap[lev], 1, scal_mf.nGrow());
-            vec_scal_mf[comp].setVal(0.);
+                    // Create sedgelx, etc.
 
-            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp + comp, 0, 1,
-                           scal_mf.nGrow());
+                    MakeEdgeScalEdges(
+                        mfi, slx_arr, srx_arr, sly_arr, sry_arr, scal_arr,
+                        sedgex_arr, sedgey_arr, force_arr, umac_arr, vmac_arr,
+                        Ipf_arr, Imf_arr, simhx_arr, simhy_arr, domainBox, bcs,
+                        dx, scomp, bccomp, is_vel, is_conservative);
+                }  // end loop over components
+            }      // end MFIter loop
         }
 
-        for (int scomp = start_scomp; scomp < start_scomp + num_comp; ++scomp) {
-            int vcomp = scomp - start_scomp;
-            int bccomp = start_bccomp + scomp - start_scomp;
+#elif (AMREX_SPACEDIM == 3)
+
+        // components of the tile scratch space
+        constexpr int iIp = 0;
+        constexpr int iIm = iIp + AMREX_SPACEDIM;
+        constexpr int islopez = iIm + AMREX_SPACEDIM;
+        constexpr int idivu = islopez + 1;
+        constexpr int islx = idivu + 1;
+        constexpr int isrx = islx + 1;
+        constexpr int isly = isrx + 1;
+        constexpr int isry = isly + 1;
+        constexpr int islz = isry + 1;
+        constexpr int isrz = islz + 1;
+        constexpr int isimhx = isrz + 1;
+        constexpr int isimhy = isimhx + 1;
+        constexpr int isimhz = isimhy + 1;
+        constexpr int isimhxy = isimhz + 1;
+        constexpr int isimhxz = isimhxy + 1;
+        constexpr int isimhyx = isimhxz + 1;
+        constexpr int isimhyz = isimhyx + 1;
+        constexpr int isimhzx = isimhyz + 1;
+        constexpr int isimhzy = isimhzx + 1;
+        constexpr int nscratch = isimhzy + 1;
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-            for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        {
+            // the scratch space of this thread, reused for each of its tiles
+            FArrayBox scratch;
+            FArrayBox force_scratch;
+
+            for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid();
+                 ++mfi) {
                 // Get the index space of the valid region
                 const Box& tileBox = mfi.tilebox();
                 const Box& obx = amrex::grow(tileBox, 1);
 
+                Array4<Real> const scal_arr = state[lev].array(mfi);
+                Array4<Real> const force_arr = force[lev].array(mfi);
+
                 Array4<Real> const umac_arr = umac[lev][0].array(mfi);
                 Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
                 Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
 
-                // make divu
-                if (is_conservative) {
-                    MakeDivU(obx, divu.array(mfi), umac_arr, vmac_arr, wmac_arr,
-                             dx);
+                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
+                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
+                Array4<Real> const sedgez_arr = sedge[lev][2].array(mfi);
+
+                scratch.resize(obx, nscratch);
+                Elixir e_scratch = scratch.elixir();
+                scratch.setVal<RunOn::Device>(0.);
+
+                const auto scratch_arr = scratch.array();
+
+                Array4<Real> const Ip_arr(scratch_arr, iIp);
+                Array4<Real> const Im_arr(scratch_arr, iIm);
+                Array4<Real> const slopez_arr(scratch_arr, islopez);
+                Array4<Real> const divu_arr(scratch_arr, idivu);
+
+                Array4<Real> const slx_arr(scratch_arr, islx);
+                Array4<Real> const srx_arr(scratch_arr, isrx);
+                Array4<Real> const sly_arr(scratch_arr, isly);
+                Array4<Real> const sry_arr(scratch_arr, isry);
+                Array4<Real> const slz_arr(scratch_arr, islz);
+                Array4<Real> const srz_arr(scratch_arr, isrz);
+
+                Array4<Real> const simhx_arr(scratch_arr, isimhx);
+                Array4<Real> const simhy_arr(scratch_arr, isimhy);
+                Array4<Real> const simhz_arr(scratch_arr, isimhz);
+
+                Array4<Real> const simhxy_arr(scratch_arr, isimhxy);
+                Array4<Real> const simhxz_arr(scratch_arr, isimhxz);
+                Array4<Real> const simhyx_arr(scratch_arr, isimhyx);
+                Array4<Real> const simhyz_arr(scratch_arr, isimhyz);
+                Array4<Real> const simhzx_arr(scratch_arr, isimhzx);
+                Array4<Real> const simhzy_arr(scratch_arr, isimhzy);
+
+                // the traced forces are only needed with ppm_trace_forces
+                Elixir e_force_scratch;
+                Array4<Real> Ipf_arr;
+                Array4<Real> Imf_arr;
+                if (ppm_trace_forces == 1) {
+                    force_scratch.resize(obx, 2 * AMREX_SPACEDIM);
+                    e_force_scratch = force_scratch.elixir();
+                    Ipf_arr = Array4<Real>(force_scratch.array(), 0);
+                    Imf_arr =
+                        Array4<Real>(force_scratch.array(), AMREX_SPACEDIM);
                 }
 
-                if (ppm_type == 0) {
-                    // we're going to reuse Ip here as slopex and Im as slopey
-                    // as they have the correct number of ghost zones
+                // make divu, which is the same for every component
+                if (is_conservative) {
+                    MakeDivU(obx, divu_arr, umac_arr, vmac_arr, wmac_arr, dx);
+                }
 
-                    // x-direction
-                    Slopex(obx, vec_scal_mf[vcomp].array(mfi), Ip.array(mfi),
-                           domainBox, bcs, 1, bccomp);
+                for (int scomp = start_scomp; scomp < start_scomp + num_comp;
+                     ++scomp) {
+                    int bccomp = start_bccomp + scomp - start_scomp;
 
-                    // y-direction
-                    Slopey(obx, vec_scal_mf[vcomp].array(mfi), Im.array(mfi),
-                           domainBox, bcs, 1, bccomp);
+                    if (ppm_type == 0) {
+                        // we're going to reuse Ip here as slopex and Im as
+                        // slopey as they have the correct number of ghost
+                        // zones
+                        Array4<Real> const s_arr(scal_arr, scomp);
 
-                    // z-direction
-                    Slopez(obx, vec_scal_mf[vcomp].array(mfi),
-                           slopez.array(mfi), domainBox, bcs, 1, bccomp);
+                        // x-direction
+                        Slopex(obx, s_arr, Ip_arr, domainBox, bcs, 1, bccomp);
 
-                } else {
-                    PPM(obx, state[lev].array(mfi), umac_arr, vmac_arr,
-                        wmac_arr, Ip.array(mfi), Im.array(mfi), domainBox, bcs,
-                        dx, true, scomp, bccomp);
-
-                    if (ppm_trace_forces == 1) {
-                        PPM(obx, force[lev].array(mfi), umac_arr, vmac_arr,
-                            wmac_arr, Ipf.array(mfi), Imf.array(mfi), domainBox,
-                            bcs, dx, true, scomp, bccomp);
-                    }
-                }
-            }
+                        // y-direction
+                        Slopey(obx, s_arr, Im_arr, domainBox, bcs, 1, bccomp);
 
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-            for (MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-                Array4<Real> const scal_arr = state[lev].array(mfi);
-
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
-                Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
+                        // z-direction
+                        Slopez(obx, s_arr, slopez_arr, domainBox, bcs, 1,
+                               bccomp);
 
-                Array4<Real> const slx_arr = slx.array(mfi);
-                Array4<Real> const srx_arr = srx.array(mfi);
-                Array4<Real> const sly_arr = sly.array(mfi);
-                Array4<Real> const sry_arr = sry.array(mfi);
-                Array4<Real> const slz_arr = slz.array(mfi);
-                Array4<Real> const srz_arr = srz.array(mfi);
-
-                Array4<Real> const simhx_arr = simhx.array(mfi);
-                Array4<Real> const simhy_arr = simhy.array(mfi);
-                Array4<Real> const simhz_arr = simhz.array(mfi);
-
-                // Create s_{\i-\half\e_x}^x, etc.
-
-                MakeEdgeScalPredictor(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr, srz_arr,
-                    scal_arr, Ip.array(mfi), Im.array(mfi), slopez.array(mfi),
-                    umac_arr, vmac_arr, wmac_arr, simhx_arr, simhy_arr,
-                    simhz_arr, domainBox, bcs, dx, scomp, bccomp, is_vel);
-
-                Array4<Real> const simhxy_arr = simhxy.array(mfi);
-                Array4<Real> const simhxz_arr = simhxz.array(mfi);
-                Array4<Real> const simhyx_arr = simhyx.array(mfi);
-                Array4<Real> const simhyz_arr = simhyz.array(mfi);
-                Array4<Real> const simhzx_arr = simhzx.array(mfi);
-                Array4<Real> const simhzy_arr = simhzy.array(mfi);
-
-                // Create transverse terms, s_{\i-\half\e_x}^{x|y}, etc.
-
-                MakeEdgeScalTransverse(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr, srz_arr,
-                    scal_arr, divu.array(mfi), umac_arr, vmac_arr, wmac_arr,
-                    simhx_arr, simhy_arr, simhz_arr, simhxy_arr, simhxz_arr,
-                    simhyx_arr, simhyz_arr, simhzx_arr, simhzy_arr, domainBox,
-                    bcs, dx, scomp, bccomp, is_vel, is_conservative);
+                    } else {
+                        PPM(obx, scal_arr, umac_arr, vmac_arr, wmac_arr,
+                            Ip_arr, Im_arr, domainBox, bcs, dx, true, scomp,
+                            bccomp);
 
-                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
-                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
-                Array4<Real> const sedgez_arr = sedge[lev][2].array(mfi);
+                        if (ppm_trace_forces == 1) {
+                            PPM(obx, force_arr, umac_arr, vmac_arr, wmac_arr,
+                                Ipf_arr, Imf_arr, domainBox, bcs, dx, true,
+                                scomp, bccomp);
+                        }
+                    }
 
-                // Create sedgelx, etc.
-
-                MakeEdgeScalEdges(
-                    mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr, srz_arr,
-                    scal_arr, sedgex_arr, sedgey_arr, sedgez_arr,
-                    force[lev].array(mfi), umac_arr, vmac_arr, wmac_arr,
-                    Ipf.array(mfi), Imf.array(mfi), simhxy_arr, simhxz_arr,
-                    simhyx_arr, simhyz_arr, simhzx_arr, simhzy_arr, domainBox,
-                    bcs, dx, scomp, bccomp, is_vel, is_conservative);
-            }  // end MFIter loop
-        }      // end loop over components
+                    // Create s_{\i-\half\e_x}^x, etc.
+
+                    MakeEdgeScalPredictor(
+                        mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr,
+                        srz_arr, scal_arr, Ip_arr, Im_arr, slopez_arr, umac_arr,
+                        vmac_arr, wmac_arr, simhx_arr, simhy_arr, simhz_arr,
+                        domainBox, bcs, dx, scomp, bccomp, is_vel);
+
+                    // Create transverse terms, s_{\i-\half\e_x}^{x|y}, etc.
+
+                    MakeEdgeScalTransverse(
+                        mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr,
+                        srz_arr, scal_arr, divu_arr, umac_arr, vmac_arr,
+                        wmac_arr, simhx_arr, simhy_arr, simhz_arr, simhxy_arr,
+                        simhxz_arr, simhyx_arr, simhyz_arr, simhzx_arr,
+                        simhzy_arr, domainBox, bcs, dx, scomp, bccomp, is_vel,
+                        is_conservative);
+
+                    // Create sedgelx, etc.
+
+                    MakeEdgeScalEdges(
+                        mfi, slx_arr, srx_arr, sly_arr, sry_arr, slz_arr,
+                        srz_arr, scal_arr, sedgex_arr, sedgey_arr, sedgez_arr,
+                        force_arr, umac_arr, vmac_arr, wmac_arr, Ipf_arr,
+                        Imf_arr, simhxy_arr, simhxz_arr, simhyx_arr,
+                        simhyz_arr, simhzx_arr, simhzy_arr, domainBox, bcs, dx,
+                        scomp, bccomp, is_vel, is_conservative);
+                }  // end loop over components
+            }      // end MFIter loop
+        }
 #endif
     }  // end loop over levels
 
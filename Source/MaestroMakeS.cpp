@@ -97,6 +97,10 @@ void Maestro::Make_S_cc(
     const auto use_delta_gamma1_term_loc = use_delta_gamma1_term;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
+        // reuse the EOS outputs if they were already computed for scal
+        const MultiFab* eos_cache_lev = EOSCacheFor(scal, lev);
+        const bool use_cache = eos_cache_lev != nullptr;
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -105,6 +109,9 @@ void Maestro::Make_S_cc(
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
 
+            const Array4<const Real> cache_arr =
+                use_cache ? eos_cache_lev->const_array(mfi)
+                          : Array4<const Real>{};
             const Array4<Real> S_cc_arr = S_cc[lev].array(mfi);
             const Array4<Real> delta_gamma1_term_arr =
                 delta_gamma1_term[lev].array(mfi);
@@ -142,10 +149,15 @@ void Maestro::Make_S_cc(
                     }
 #endif
 
-                    // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-
-                    auto eos_xderivs = composition_derivatives(eos_state);
+                    eos_xderivs_t eos_xderivs;
+                    if (use_cache) {
+                        EOSCache::Load(cache_arr, i, j, k, eos_state);
+                        eos_xderivs = EOSCache::LoadXderivs(cache_arr, i, j, k);
+                    } else {
+                        // dens, temp, and xmass are inputs
+                        eos(eos_input_rt, eos_state);
+                        eos_xderivs = composition_derivatives(eos_state);
+                    }
 
                     Real sigma =
                         eos_state.dpdT /
@@ -215,10 +227,15 @@ void Maestro::Make_S_cc(
                     }
 #endif
 
-                    // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-
-                    auto eos_xderivs = composition_derivatives(eos_state);
+                    eos_xderivs_t eos_xderivs;
+                    if (use_cache) {
+                        EOSCache::Load(cache_arr, i, j, k, eos_state);
+                        eos_xderivs = EOSCache::LoadXderivs(cache_arr, i, j, k);
+                    } else {
+                        // dens, temp, and xmass are inputs
+                        eos(eos_input_rt, eos_state);
+                        eos_xderivs = composition_derivatives(eos_state);
+                    }
 
                     Real sigma =
                         eos_state.dpdT /
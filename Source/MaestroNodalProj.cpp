@@ -21,6 +21,7 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
                         int istep_divu_iter, bool sdc_off) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::NodalProj()", NodalProj);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::nodalproj);
 
     AMREX_ASSERT(rhcc[0].nGrow() == 1);
 
@@ -167,23 +168,40 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
         }
     }
 
-    LPInfo info;
-    info.setMetricTerm(false);
+    // The operator and the MLMG solver only depend on the grids, so we keep
+    // them between calls and rebuild them after the grids change. Only sigma
+    // is updated for each solve.
+    if (!nodal_solver || nodal_solver_generation != grids_generation) {
+        LPInfo info;
+        info.setMetricTerm(false);
 
-    if (hg_bottom_solver == 4) {
-        info.setAgglomeration(true);
-        info.setConsolidation(true);
-    } else {
-        info.setAgglomeration(false);
-        info.setConsolidation(false);
-    }
+        if (hg_bottom_solver == 4) {
+            info.setAgglomeration(true);
+            info.setConsolidation(true);
+        } else {
+            info.setAgglomeration(false);
+            info.setConsolidation(false);
+        }
+
+        // the solver refers to the operator, so it has to go first
+        nodal_solver.reset();
 
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLNodeLaplacian mlndlap(Geom(0, finest_level), grids, dmap, info);
-    mlndlap.setGaussSeidel(true);
-    mlndlap.setHarmonicAverage(false);
+        // Only pass up to defined level to prevent looping over undefined grids.
+        nodal_linop = std::make_unique<MLNodeLaplacian>(Geom(0, finest_level),
+                                                        grids, dmap, info);
+        nodal_linop->setGaussSeidel(true);
+        nodal_linop->setHarmonicAverage(false);
 
-    mlndlap.setDomainBC(mlmg_lobc, mlmg_hibc);
+        nodal_linop->setDomainBC(mlmg_lobc, mlmg_hibc);
+
+        nodal_solver = std::make_unique<MLMG>(*nodal_linop);
+        nodal_solver->setVerbose(mg_verbose);
+        nodal_solver->setBottomVerbose(cg_verbose);
+
+        nodal_solver_generation = grids_generation;
+    }
+
+    MLNodeLaplacian& mlndlap = *nodal_linop;
 
     // set sig in the MLNodeLaplacian object
     for (int ilev = 0; ilev <= finest_level; ++ilev) {
@@ -238,9 +256,7 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
         rhcc[lev].mult(-1.0, 0, 1, 1);
     }
 
-    MLMG mlmg(mlndlap);
-    mlmg.setVerbose(mg_verbose);
-    mlmg.setBottomVerbose(cg_verbose);
+    MLMG& mlmg = *nodal_solver;
 
     Real abs_tol = -1.;  // disable absolute tolerance
     Real rel_tol = 1.e-3;
@@ -284,6 +300,16 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
             amrex::min(eps_hg_max, eps_hg * pow(hg_level_factor, finest_level));
     }
 
+    // start a regular time step projection from the solution of the last
+    // one. phi is roughly dt*pi, so rescale it by the change in dt
+    if (proj_type == regular_timestep_comp && warm_start_projections &&
+        nodal_phi_warm_valid) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(phi[lev], nodal_phi_warm[lev], 0, 0, 1, 0);
+            phi[lev].mult(dt / nodal_phi_warm_dt, 0, 1, 0);
+        }
+    }
+
     // solve for phi
     Print() << "Calling nodal solver" << std::endl;
 #ifdef AMREX_USE_CUDA
@@ -303,6 +329,26 @@ void Maestro::NodalProj(int proj_type, Vector<MultiFab>& rhcc,
 #endif
     Print() << "Done calling nodal solver" << std::endl;
 
+    if (maestro_verbose > 0) {
+        Print() << "Nodal projection (proj_type " << proj_type
+                << "): " << mlmg.getNumIters()
+                << " MLMG iterations, rel_tol = " << rel_tol << std::endl;
+    }
+
+    // save the solution as the initial guess for the next time step
+    if (proj_type == regular_timestep_comp && warm_start_projections) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            const BoxArray nodal_grids = convert(grids[lev], nodal_flag);
+            if (nodal_phi_warm[lev].boxArray() != nodal_grids ||
+                nodal_phi_warm[lev].DistributionMap() != dmap[lev]) {
+                nodal_phi_warm[lev].define(nodal_grids, dmap[lev], 1, 0);
+            }
+            MultiFab::Copy(nodal_phi_warm[lev], phi[lev], 0, 0, 1, 0);
+        }
+        nodal_phi_warm_dt = dt;
+        nodal_phi_warm_valid = true;
+    }
+
     // convert beta0*Vproj back to Vproj
     for (int lev = 0; lev <= finest_level; ++lev) {
         for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
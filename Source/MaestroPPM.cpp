@@ -1,5 +1,6 @@
 
 #include <Maestro.H>
+#include <MaestroParallelForBC.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -31,8 +32,16 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
 
+    // the EXT_DIR and HOEXTRAP stencils reach 2 zones in from the
+    // domain faces; boxes that stop short of that skip them entirely
+    bool has_lo_bc = (bclo == EXT_DIR || bclo == HOEXTRAP) &&
+                     bx.smallEnd(0) <= domlo[0] + 2;
+    bool has_hi_bc = (bchi == EXT_DIR || bchi == HOEXTRAP) &&
+                     bx.bigEnd(0) >= domhi[0] - 2;
+
     if (ppm_type == 1) {
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const auto kernel = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
             // Compute van Leer slopes in x-direction
 
             // sm
@@ -117,7 +126,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
 
             // Different stencil needed for x-component of EXT_DIR and HOEXTRAP adv_bc's.
             if (i == domlo[0]) {
-                if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+                if (lo_bc) {
                     // The value in the first cc ghost cell represents the edge value.
                     sm = s(i - 1, j, k, n);
 
@@ -133,7 +142,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (i == domlo[0] + 1) {
-                if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+                if (lo_bc) {
                     // Use a modified stencil to get sedge on the first interior edge.
                     sm = -0.2 * s(i - 2, j, k, n) + 0.75 * s(i - 1, j, k, n) +
                          0.5 * s(i, j, k, n) - 0.05 * s(i + 1, j, k, n);
@@ -161,7 +170,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (i == domhi[0]) {
-                if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+                if (hi_bc) {
                     // The value in the first cc ghost cell represents the edge value.
                     sp = s(i + 1, j, k, n);
 
@@ -177,7 +186,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (i == domhi[0] - 1) {
-                if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+                if (hi_bc) {
                     // Use a modified stencil to get sp on the first interior edge.
                     sp = -0.2 * s(i + 2, j, k, n) + 0.75 * s(i + 1, j, k, n) +
                          0.5 * s(i, j, k, n) - 0.05 * s(i - 1, j, k, n);
@@ -250,10 +259,12 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                     Im(i, j, k, 0) = s(i, j, k, n);
                 }
             }
-        });
+        };
+        maestro::ParallelForBC(bx, has_lo_bc, has_hi_bc, kernel);
 
     } else if (ppm_type == 2) {
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const auto kernel = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
             // -1
             // Interpolate s to x-edges.
             Real sedgel =
@@ -442,7 +453,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
             Real sp = s(i, j, k, n) + alphap;
 
             // different stencil needed for x-component of EXT_DIR and HOEXTRAP adv_bc's
-            if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+            if (lo_bc) {
                 if (i == domlo[0]) {
                     // The value in the first cc ghost cell represents the edge value.
                     sm = s(i - 1, j, k, n);
@@ -581,7 +592,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
             }
 
-            if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+            if (hi_bc) {
                 if (i == domhi[0]) {
                     // The value in the first cc ghost cell represents the edge value.
                     sp = s(i + 1, j, k, n);
@@ -768,7 +779,8 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                     Im(i, j, k, 0) = s(i, j, k, n);
                 }
             }
-        });
+        };
+        maestro::ParallelForBC(bx, has_lo_bc, has_hi_bc, kernel);
     }
 
     /////////////
@@ -776,9 +788,14 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
     /////////////
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
+    has_lo_bc = (bclo == EXT_DIR || bclo == HOEXTRAP) &&
+                bx.smallEnd(1) <= domlo[1] + 2;
+    has_hi_bc = (bchi == EXT_DIR || bchi == HOEXTRAP) &&
+                bx.bigEnd(1) >= domhi[1] - 2;
 
     if (ppm_type == 1) {
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const auto kernel = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
             // Compute van Leer slopes in y-direction.
 
             // sm
@@ -863,7 +880,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
 
             // Different stencil needed for y-component of EXT_DIR and HOEXTRAP adv_bc's.
             if (j == domlo[1]) {
-                if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+                if (lo_bc) {
                     // The value in the first cc ghost cell represents the edge value.
                     sm = s(i, j - 1, k, n);
 
@@ -879,7 +896,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (j == domlo[1] + 1) {
-                if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+                if (lo_bc) {
                     // Use a modified stencil to get sm on the first interior edge.
                     sm = -0.2 * s(i, j - 2, k, n) + 0.75 * s(i, j - 1, k, n) +
                          0.5 * s(i, j, k, n) - 0.05 * s(i, j + 1, k, n);
@@ -907,7 +924,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (j == domhi[1]) {
-                if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+                if (hi_bc) {
                     // The value in the first cc ghost cell represents the edge value.
                     sp = s(i, j + 1, k, n);
 
@@ -923,7 +940,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (j == domhi[1] - 1) {
-                if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+                if (hi_bc) {
                     // Use a modified stencil to get sp on the first interior edge.
                     sp = -0.2 * s(i, j + 2, k, n) + 0.75 * s(i, j + 1, k, n) +
                          0.5 * s(i, j, k, n) - 0.05 * s(i, j - 1, k, n);
@@ -996,10 +1013,12 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                     Im(i, j, k, 1) = s(i, j, k, n);
                 }
             }
-        });
+        };
+        maestro::ParallelForBC(bx, has_lo_bc, has_hi_bc, kernel);
 
     } else if (ppm_type == 2) {
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const auto kernel = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
             // -1
             // Interpolate s to y-edges.
             Real sedgel =
@@ -1186,7 +1205,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
             Real sp = s(i, j, k, n) + alphap;
 
             // Different stencil needed for y-component of EXT_DIR and HOEXTRAP adv_bc's.
-            if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+            if (lo_bc) {
                 if (j == domlo[1]) {
                     // The value in the first cc ghost cell represents the edge value.
                     sm = s(i, j - 1, k, n);
@@ -1325,7 +1344,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
             }
 
-            if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+            if (hi_bc) {
                 if (j == domhi[1]) {
                     // The value in the first cc ghost cell represents the edge value.
                     sp = s(i, j + 1, k, n);
@@ -1510,7 +1529,8 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                     Im(i, j, k, 1) = s(i, j, k, n);
                 }
             }
-        });
+        };
+        maestro::ParallelForBC(bx, has_lo_bc, has_hi_bc, kernel);
     }
 
 #if (AMREX_SPACEDIM == 3)
@@ -1519,9 +1539,14 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
     /////////////
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
+    has_lo_bc = (bclo == EXT_DIR || bclo == HOEXTRAP) &&
+                bx.smallEnd(2) <= domlo[2] + 2;
+    has_hi_bc = (bchi == EXT_DIR || bchi == HOEXTRAP) &&
+                bx.bigEnd(2) >= domhi[2] - 2;
 
     if (ppm_type == 1) {
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const auto kernel = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
             // Compute van Leer slopes in z-direction.
 
             // sm
@@ -1606,7 +1631,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
 
             // Different stencil needed for z-component of EXT_DIR and HOEXTRAP adv_bc's.
             if (k == domlo[2]) {
-                if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+                if (lo_bc) {
                     // The value in the first cc ghost cell represents the edge value.
                     sm = s(i, j, k - 1, n);
 
@@ -1622,7 +1647,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (k == domlo[2] + 1) {
-                if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+                if (lo_bc) {
                     // Use a modified stencil to get sm on the first interior edge.
                     sm = -0.2 * s(i, j, k - 2, n) + 0.75 * s(i, j, k - 1, n) +
                          0.5 * s(i, j, k, n) - 0.05 * s(i, j, k + 1, n);
@@ -1650,7 +1675,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (k == domhi[2]) {
-                if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+                if (hi_bc) {
                     // The value in the first cc ghost cell represents the edge value.
                     sp = s(i, j, k + 1, n);
 
@@ -1666,7 +1691,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
 
             } else if (k == domhi[2] - 1) {
-                if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+                if (hi_bc) {
                     // Use a modified stencil to get sedge on the first interior edge.
                     sp = -0.2 * s(i, j, k + 2, n) + 0.75 * s(i, j, k + 1, n) +
                          0.5 * s(i, j, k, n) - 0.05 * s(i, j, k - 1, n);
@@ -1742,10 +1767,12 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                     Im(i, j, k, 2) = s(i, j, k, n);
                 }
             }
-        });
+        };
+        maestro::ParallelForBC(bx, has_lo_bc, has_hi_bc, kernel);
 
     } else if (ppm_type == 2) {
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+        const auto kernel = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
             // -1
             // Interpolate s to z-edges.
             Real sedgel =
@@ -1931,7 +1958,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
             Real sp = s(i, j, k, n) + alphap;
 
             // Different stencil needed for z-component of EXT_DIR and HOEXTRAP adv_bc's.
-            if (bclo == EXT_DIR || bclo == HOEXTRAP) {
+            if (lo_bc) {
                 if (k == domlo[2]) {
                     // The value in the first cc ghost cell represents the edge value.
                     sm = s(i, j, k - 1, n);
@@ -2069,7 +2096,7 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                 }
             }
 
-            if (bchi == EXT_DIR || bchi == HOEXTRAP) {
+            if (hi_bc) {
                 if (k == domhi[2]) {
                     // The value in the first cc ghost cell represents the edge value.
                     sp = s(i, j, k + 1, n);
@@ -2258,7 +2285,8 @@ void Maestro::PPM(const Box& bx, Array4<const Real> const s,
                     Im(i, j, k, 2) = s(i, j, k, n);
                 }
             }
-        });
+        };
+        maestro::ParallelForBC(bx, has_lo_bc, has_hi_bc, kernel);
     }
 #endif
 }
@@ -1,3 +1,4 @@
+#include <AMReX_AsyncOut.H>
 #include <AMReX_buildInfo.H>
 #include <Maestro.H>
 #include <MaestroPlot.H>
@@ -31,6 +32,10 @@ void Maestro::WritePlotFile(
     // wallclock time
     const Real strt_total = ParallelDescriptor::second();
 
+    // with async_io, make sure the previous plotfile or checkpoint is
+    // completely on disk before we start on this one
+    AsyncOut::Finish();
+
     std::string plotfilename;
 
     if (!is_small) {
@@ -123,11 +128,23 @@ void Maestro::WritePlotFile(
 
     WriteJobInfo(plotfilename);
 
-    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
-
-    // write out the cell-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
-        for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
+    // write out the base state. The lambda holds its own copy of the base
+    // state so that with async_io it can be written in the background,
+    // after WriteMultiLevelPlotfile has queued the MultiFab data. The
+    // geometry is fixed for the run, so we only keep views of it.
+    const int max_radial_level = base_geom.max_radial_level;
+    auto write_base_state = [plotfilename, max_radial_level,
+                             nr = base_geom.nr, r_cc_loc = base_geom.r_cc_loc,
+                             r_edge_loc = base_geom.r_edge_loc,
+                             rho0 = rho0_in,
+                             rhoh0 = rhoh0_in,
+                             p0 = p0_in,
+                             gamma1bar = gamma1bar_in,
+                             w0 = w0]() {
+        VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+        // write out the cell-centered base state
+        for (int lev = 0; lev <= max_radial_level; ++lev) {
             std::ofstream BaseCCFile;
             BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(),
                                           io_buffer.size());
@@ -145,19 +162,17 @@ void Maestro::WritePlotFile(
 
             BaseCCFile << "r_cc  rho0  rhoh0  p0  gamma1bar \n";
 
-            for (int i = 0; i < base_geom.nr(lev); ++i) {
-                BaseCCFile << base_geom.r_cc_loc(lev, i) << " "
-                           << rho0_in.array()(lev, i) << " "
-                           << rhoh0_in.array()(lev, i) << " "
-                           << p0_in.array()(lev, i) << " "
-                           << gamma1bar_in.array()(lev, i) << "\n";
+            for (int i = 0; i < nr(lev); ++i) {
+                BaseCCFile << r_cc_loc(lev, i) << " "
+                           << rho0.array()(lev, i) << " "
+                           << rhoh0.array()(lev, i) << " "
+                           << p0.array()(lev, i) << " "
+                           << gamma1bar.array()(lev, i) << "\n";
             }
         }
-    }
 
-    // write out the face-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
-        for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
+        // write out the face-centered base state
+        for (int lev = 0; lev <= max_radial_level; ++lev) {
             std::ofstream BaseFCFile;
             BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(),
                                           io_buffer.size());
@@ -175,11 +190,19 @@ void Maestro::WritePlotFile(
 
             BaseFCFile << "r_edge  w0 \n";
 
-            for (int i = 0; i <= base_geom.nr(lev); ++i) {
-                BaseFCFile << base_geom.r_edge_loc(lev, i) << " "
+            for (int i = 0; i <= nr(lev); ++i) {
+                BaseFCFile << r_edge_loc(lev, i) << " "
                            << w0.array()(lev, i) << "\n";
             }
         }
+    };
+
+    if (ParallelDescriptor::IOProcessor()) {
+        if (AsyncOut::UseAsyncOut()) {
+            AsyncOut::Submit(std::move(write_base_state));
+        } else {
+            write_base_state();
+        }
     }
 
     // wallclock time
@@ -327,12 +350,16 @@ Vector<const MultiFab*> Maestro::PlotFileMF(
     }
 
 #ifndef SDC
-    if (dt_in < small_dt) {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt,
-              t_in);
-    } else {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt_in * 0.5,
-              t_in);
+    // reuse the rates from the end of the step if we can, otherwise
+    // react the state again to get them
+    if (!GetCachedReactionRates(t_in, rho_Hext, rho_omegadot, rho_Hnuc)) {
+        if (dt_in < small_dt) {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in,
+                  small_dt, t_in);
+        } else {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in,
+                  dt_in * 0.5, t_in);
+        }
     }
 #else
     if (dt_in < small_dt) {
@@ -1482,6 +1509,10 @@ void Maestro::MakeAdExcess(const Vector<MultiFab>& state,
         MultiFab pres_mf(grids[lev], dmap[lev], 1, 0);
         MultiFab nabla_ad_mf(grids[lev], dmap[lev], 1, 0);
 
+        // reuse the EOS outputs if they were already computed for state
+        const MultiFab* eos_cache_lev = EOSCacheFor(state, lev);
+        const bool use_cache = eos_cache_lev != nullptr;
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -1491,6 +1522,9 @@ void Maestro::MakeAdExcess(const Vector<MultiFab>& state,
             const Box& tileBox = mfi.tilebox();
 
             const Array4<const Real> state_arr = state[lev].array(mfi);
+            const Array4<const Real> cache_arr =
+                use_cache ? eos_cache_lev->const_array(mfi)
+                          : Array4<const Real>{};
             const Array4<Real> ad_excess_arr = ad_excess[lev].array(mfi);
             const Array4<Real> pres = pres_mf.array(mfi);
             const Array4<Real> nabla_ad = nabla_ad_mf.array(mfi);
@@ -1514,7 +1548,11 @@ void Maestro::MakeAdExcess(const Vector<MultiFab>& state,
                 }
 #endif
 
-                eos(eos_input_rt, eos_state);
+                if (use_cache) {
+                    EOSCache::Load(cache_arr, i, j, k, eos_state);
+                } else {
+                    eos(eos_input_rt, eos_state);
+                }
 
                 pres(i, j, k) = eos_state.p;
                 // Print() << "pres = " << pres(i,j,k) << std::endl;
@@ -2266,6 +2304,10 @@ void Maestro::MakeEntropy(const Vector<MultiFab>& state,
     BL_PROFILE_VAR("Maestro::MakeEntropy()", MakeEntropy);
 
     for (int lev = 0; lev <= finest_level; ++lev) {
+        // reuse the EOS outputs if they were already computed for state
+        const MultiFab* eos_cache_lev = EOSCacheFor(state, lev);
+        const bool use_cache = eos_cache_lev != nullptr;
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -2275,6 +2317,9 @@ void Maestro::MakeEntropy(const Vector<MultiFab>& state,
             const Box& tileBox = mfi.tilebox();
 
             const Array4<const Real> state_arr = state[lev].array(mfi);
+            const Array4<const Real> cache_arr =
+                use_cache ? eos_cache_lev->const_array(mfi)
+                          : Array4<const Real>{};
             const Array4<Real> entropy_arr = entropy[lev].array(mfi);
 
             ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
@@ -2293,7 +2338,11 @@ void Maestro::MakeEntropy(const Vector<MultiFab>& state,
                 }
 #endif
 
-                eos(eos_input_rt, eos_state);
+                if (use_cache) {
+                    EOSCache::Load(cache_arr, i, j, k, eos_state);
+                } else {
+                    eos(eos_input_rt, eos_state);
+                }
 
                 entropy_arr(i, j, k) = eos_state.s;
             });
@@ -12,6 +12,10 @@ void Maestro::React(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                     const Real dt_in, const Real time_in) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::React()", React);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::react);
+
+    // s_out is about to change
+    InvalidateEOSCache();
 
     // external heating
     if (do_heating) {
@@ -90,6 +94,7 @@ void Maestro::ReactSDC(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
                        Vector<MultiFab>& source) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::ReactSDC()", ReactSDC);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::react);
 
     // external heating
     if (do_heating) {
@@ -320,6 +325,54 @@ void Maestro::ReactSDC(const Vector<MultiFab>& s_in, Vector<MultiFab>& s_out,
 // }
 // #endif
 
+// save the reaction rates computed at the end of a time step
+void Maestro::CacheReactionRates(const Vector<MultiFab>& rho_Hext,
+                                 const Vector<MultiFab>& rho_omegadot,
+                                 const Vector<MultiFab>& rho_Hnuc,
+                                 const Real time) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::CacheReactionRates()", CacheReactionRates);
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        rho_Hext_cache[lev].define(grids[lev], dmap[lev], 1, 0);
+        rho_omegadot_cache[lev].define(grids[lev], dmap[lev], NumSpec, 0);
+        rho_Hnuc_cache[lev].define(grids[lev], dmap[lev], 1, 0);
+
+        MultiFab::Copy(rho_Hext_cache[lev], rho_Hext[lev], 0, 0, 1, 0);
+        MultiFab::Copy(rho_omegadot_cache[lev], rho_omegadot[lev], 0, 0,
+                       NumSpec, 0);
+        MultiFab::Copy(rho_Hnuc_cache[lev], rho_Hnuc[lev], 0, 0, 1, 0);
+    }
+
+    react_cache_time = time;
+}
+
+bool Maestro::GetCachedReactionRates(const Real time,
+                                     Vector<MultiFab>& rho_Hext,
+                                     Vector<MultiFab>& rho_omegadot,
+                                     Vector<MultiFab>& rho_Hnuc) {
+    // the cache is stale if it is for a different state or the grids
+    // have changed since it was made
+    if (react_cache_time < 0.0 || time != react_cache_time) {
+        return false;
+    }
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (rho_Hnuc_cache[lev].boxArray() != grids[lev] ||
+            rho_Hnuc_cache[lev].DistributionMap() != dmap[lev]) {
+            return false;
+        }
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(rho_Hext[lev], rho_Hext_cache[lev], 0, 0, 1, 0);
+        MultiFab::Copy(rho_omegadot[lev], rho_omegadot_cache[lev], 0, 0,
+                       NumSpec, 0);
+        MultiFab::Copy(rho_Hnuc[lev], rho_Hnuc_cache[lev], 0, 0, 1, 0);
+    }
+
+    return true;
+}
+
 // compute heating terms, rho_omegadot and rho_Hnuc
 void Maestro::MakeReactionRates(Vector<MultiFab>& rho_omegadot,
                                 Vector<MultiFab>& rho_Hnuc,
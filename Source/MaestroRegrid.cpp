@@ -12,6 +12,10 @@ void Maestro::Regrid() {
     // wallclock time
     const Real strt_total = ParallelDescriptor::second();
 
+    // the pooled temporaries live on the old grids, so free them before
+    // the new grids are allocated
+    mf_pool.clear();
+
     BaseState<Real> rho0_temp(base_geom.max_radial_level + 1,
                               base_geom.nr_fine);
 
@@ -216,6 +220,8 @@ void Maestro::RemakeLevel(int lev, Real time, const BoxArray& ba,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::RemakeLevel()", RemakeLevel);
 
+    ++grids_generation;
+
     const int ng_snew = snew[lev].nGrow();
     const int ng_u = unew[lev].nGrow();
     const int ng_S = S_cc_new[lev].nGrow();
@@ -277,12 +283,15 @@ void Maestro::RemakeLevel(int lev, Real time, const BoxArray& ba,
         iMultiFab cell_cc_to_r_state(ba, dm, 1, ng_c);
         std::swap(normal_state, normal[lev]);
         std::swap(cell_cc_to_r_state, cell_cc_to_r[lev]);
+        radial_bin_map_valid = false;
     }
 
     if (lev > 0 && reflux_type == 2) {
         flux_reg_s[lev] = std::make_unique<FluxRegister>(
             ba, dm, refRatio(lev - 1), lev, Nscal);
     }
+
+    RegridWarmStart(lev, time, ba, dm, false);
 }
 
 // within a call to AmrCore::regrid, this function fills in data at a level
@@ -293,6 +302,8 @@ void Maestro::MakeNewLevelFromCoarse(int lev, Real time, const BoxArray& ba,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeNewLevelFromCoarse()", MakeNewLevelFromCoarse);
 
+    ++grids_generation;
+
     sold[lev].define(ba, dm, Nscal, 0);
     snew[lev].define(ba, dm, Nscal, 0);
     uold[lev].define(ba, dm, AMREX_SPACEDIM, 0);
@@ -312,6 +323,7 @@ void Maestro::MakeNewLevelFromCoarse(int lev, Real time, const BoxArray& ba,
     if (spherical) {
         normal[lev].define(ba, dm, 3, 1);
         cell_cc_to_r[lev].define(ba, dm, 1, 0);
+        radial_bin_map_valid = false;
     }
 
     if (lev > 0 && reflux_type == 2) {
@@ -329,6 +341,8 @@ void Maestro::MakeNewLevelFromCoarse(int lev, Real time, const BoxArray& ba,
 #ifdef SDC
     FillCoarsePatch(lev, time, intra[lev], intra, intra, 0, 0, Nscal, bcs_f);
 #endif
+
+    RegridWarmStart(lev, time, ba, dm, true);
 }
 
 // within a call to AmrCore::regrid, this function deletes all data
@@ -338,6 +352,8 @@ void Maestro::ClearLevel(int lev) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::ClearLevel()", ClearLevel);
 
+    ++grids_generation;
+
     sold[lev].clear();
     snew[lev].clear();
     uold[lev].clear();
@@ -352,12 +368,68 @@ void Maestro::ClearLevel(int lev) {
 #ifdef SDC
     intra[lev].clear();
 #endif
+    burn_cost[lev].clear();
+    burn_cache[lev].clear();
     if (spherical) {
         normal[lev].clear();
         cell_cc_to_r[lev].clear();
+        radial_bin_map[lev].clear();
+        radial_bin_map_valid = false;
     }
 
     flux_reg_s[lev].reset(nullptr);
+    macphi_warm[lev].clear();
+    nodal_phi_warm[lev].clear();
+}
+
+// move the projection initial guesses onto the new grids at level lev
+void Maestro::RegridWarmStart(int lev, Real time, const BoxArray& ba,
+                              const DistributionMapping& dm,
+                              const bool is_new_level) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::RegridWarmStart()", RegridWarmStart);
+
+    if (macphi_warm_valid) {
+        MultiFab macphi_state(ba, dm, 1, 0);
+        if (is_new_level) {
+            FillCoarsePatch(lev, time, macphi_state, macphi_warm, macphi_warm,
+                            0, 0, 1, bcs_f);
+        } else {
+            FillPatch(lev, time, macphi_state, macphi_warm, macphi_warm, 0, 0,
+                      1, 0, bcs_f);
+        }
+        std::swap(macphi_state, macphi_warm[lev]);
+    }
+
+    if (nodal_phi_warm_valid) {
+        // phi is nodal, so FillPatch won't do. The nodal solver imposes its
+        // own boundary conditions, so there are no physical boundaries to
+        // fill here, only the interpolation from the coarser level.
+        MultiFab phi_state(convert(ba, nodal_flag), dm, 1, 0);
+        PhysBCFunctNoOp physbc;
+        Vector<BCRec> bcs{bcs_f[0]};
+        Interpolater* mapper = &node_bilinear_interp;
+
+        Vector<MultiFab*> fmf{&nodal_phi_warm[lev]};
+        Vector<Real> ftime{time};
+
+        if (lev == 0) {
+            FillPatchSingleLevel(phi_state, time, fmf, ftime, 0, 0, 1,
+                                 geom[lev], physbc, 0);
+        } else if (is_new_level) {
+            InterpFromCoarseLevel(phi_state, time, nodal_phi_warm[lev - 1], 0,
+                                  0, 1, geom[lev - 1], geom[lev], physbc, 0,
+                                  physbc, 0, refRatio(lev - 1), mapper, bcs,
+                                  0);
+        } else {
+            Vector<MultiFab*> cmf{&nodal_phi_warm[lev - 1]};
+            Vector<Real> ctime{time};
+            FillPatchTwoLevels(phi_state, time, cmf, ctime, fmf, ftime, 0, 0, 1,
+                               geom[lev - 1], geom[lev], physbc, 0, physbc, 0,
+                               refRatio(lev - 1), mapper, bcs, 0);
+        }
+        std::swap(phi_state, nodal_phi_warm[lev]);
+    }
 }
 
 void Maestro::RegridBaseState(BaseState<Real>& base_s, const bool is_edge) {
@@ -8,17 +8,12 @@ void Maestro::TfromRhoH(Vector<MultiFab>& scal, const BaseState<Real>& p0) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::TfromRhoH()", TfromRhoH);
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
+        // p0 at the cell centers
+        const auto p0_arr = MakeBaseStateCartView(lev, p0);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -28,7 +23,6 @@ void Maestro::TfromRhoH(Vector<MultiFab>& scal, const BaseState<Real>& p0) {
             const Box& tileBox = mfi.tilebox();
 
             const Array4<Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
 
             if (use_eos_e_instead_of_h_loc) {
                 // (rho, (h->e)) --> T, p
@@ -94,17 +88,12 @@ void Maestro::TfromRhoP(Vector<MultiFab>& scal, const BaseState<Real>& p0,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::TfromRhoP()", TfromRhoP);
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
     const auto use_pprime_in_tfromp_loc = use_pprime_in_tfromp;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
+        // p0 at the cell centers
+        const auto p0_arr = MakeBaseStateCartView(lev, p0);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -113,7 +102,6 @@ void Maestro::TfromRhoP(Vector<MultiFab>& scal, const BaseState<Real>& p0,
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
             const Array4<Real> state = scal[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
 
             // (rho, p) --> T
             ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
@@ -219,17 +207,12 @@ void Maestro::MachfromRhoH(const Vector<MultiFab>& scal,
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MachfromRhoH()", MachfromRhoH);
 
-    Vector<MultiFab> p0_cart(finest_level + 1);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        p0_cart[lev].define(grids[lev], dmap[lev], 1, 0);
-        p0_cart[lev].setVal(0.);
-    }
-    Put1dArrayOnCart(p0, p0_cart, false, false, bcs_f, 0);
-
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
+        // p0 at the cell centers
+        const auto p0_arr = MakeBaseStateCartView(lev, p0);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -239,7 +222,6 @@ void Maestro::MachfromRhoH(const Vector<MultiFab>& scal,
             const Box& tileBox = mfi.tilebox();
             const Array4<const Real> state = scal[lev].array(mfi);
             const Array4<const Real> u = vel[lev].array(mfi);
-            const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
             const Array4<const Real> w0_arr = w0cart[lev].array(mfi);
             const Array4<Real> mach_arr = mach[lev].array(mfi);
 
@@ -353,6 +335,71 @@ void Maestro::CsfromRhoH(const Vector<MultiFab>& scal,
     FillPatch(t_old, cs, cs, cs, 0, 0, 1, 0, bcs_f);
 }
 
+void Maestro::MakeEOSCache(const Vector<MultiFab>& scal) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeEOSCache()", MakeEOSCache);
+
+    InvalidateEOSCache();
+
+    if (!use_eos_cache) {
+        return;
+    }
+
+    const auto use_thermal_diffusion_loc = use_thermal_diffusion;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (eos_cache[lev].boxArray() != grids[lev] ||
+            eos_cache[lev].DistributionMap() != dmap[lev]) {
+            eos_cache[lev].define(grids[lev], dmap[lev], EOSCache::ncomp, 1);
+        }
+
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(scal[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            // Get the index space of the valid region and one ghost cell
+            const Box& gtbx = mfi.growntilebox(1);
+
+            const Array4<const Real> scal_arr = scal[lev].array(mfi);
+            const Array4<Real> cache_arr = eos_cache[lev].array(mfi);
+
+            ParallelFor(gtbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                eos_t eos_state;
+
+                eos_state.rho = scal_arr(i, j, k, Rho);
+                eos_state.T = scal_arr(i, j, k, Temp);
+                for (auto n = 0; n < NumSpec; ++n) {
+                    eos_state.xn[n] =
+                        scal_arr(i, j, k, FirstSpec + n) / eos_state.rho;
+                }
+#if NAUX_NET > 0
+                for (auto n = 0; n < NumAux; ++n) {
+                    eos_state.aux[n] =
+                        scal_arr(i, j, k, FirstAux + n) / eos_state.rho;
+                }
+#endif
+
+                // dens, temp, and xmass are inputs
+                eos(eos_input_rt, eos_state);
+
+                if (use_thermal_diffusion_loc) {
+                    conductivity(eos_state);
+                } else {
+                    eos_state.conductivity = 0.0;
+                }
+
+                const auto eos_xderivs = composition_derivatives(eos_state);
+
+                EOSCache::Store(cache_arr, i, j, k, eos_state, eos_xderivs);
+            });
+        }
+    }
+
+    eos_cache_state = &scal;
+    eos_cache_generation = grids_generation;
+}
+
 void Maestro::HfromRhoTedge(
     Vector<std::array<MultiFab, AMREX_SPACEDIM> >& sedge,
     const BaseState<Real>& rho0_edge_old, const BaseState<Real>& rhoh0_edge_old,
@@ -146,7 +146,7 @@ void Maestro::Setup() {
 
     // diag file data arrays
     diagfile1_data.resize(diag_buf_size * 11);
-    diagfile2_data.resize(diag_buf_size * 11);
+    diagfile2_data.resize(diag_buf_size * 12);
     diagfile3_data.resize(diag_buf_size * 10);
 
     // make sure C++ is as efficient as possible with memory usage
@@ -190,6 +190,27 @@ void Maestro::Setup() {
     rhcc_for_nodalproj.resize(max_level + 1);
     normal.resize(max_level + 1);
     cell_cc_to_r.resize(max_level + 1);
+    radial_bin_map.resize(max_level + 1);
+    radial_bin_map_valid = false;
+    burn_cost.resize(max_level + 1);
+    burn_cache.resize(max_level + 1);
+    burn_cache_hits = 0;
+    burn_cache_lookups = 0;
+    rho_Hext_cache.resize(max_level + 1);
+    rho_omegadot_cache.resize(max_level + 1);
+    rho_Hnuc_cache.resize(max_level + 1);
+    react_cache_time = -1.0;
+    grids_generation = 0;
+    mac_solver_generation = -1;
+    nodal_solver_generation = -1;
+    macphi_warm.resize(max_level + 1);
+    nodal_phi_warm.resize(max_level + 1);
+    nodal_phi_warm_dt = 0.0;
+    macphi_warm_valid = false;
+    nodal_phi_warm_valid = false;
+    eos_cache.resize(max_level + 1);
+    eos_cache_state = nullptr;
+    eos_cache_generation = -1;
 
     // stores fluxes at coarse-fine interface for synchronization
     // this will be sized "max_level+2"
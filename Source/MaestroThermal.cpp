@@ -1,10 +1,28 @@
-
 #include <AMReX_VisMF.H>
 #include <Maestro.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
 
+namespace {
+// what the face sweep of ApplyThermal needs to know about one component
+struct ThermalComp {
+    // index of the term
+    int n;
+    // component of scal that phi is made from, or -1 for p0
+    int scal_comp;
+    // phi is the component per unit mass, i.e. divided by rho
+    int per_mass;
+    // boundary condition at each domain face: 0 for periodic,
+    // 1 for homogeneous Neumann, 2 for Dirichlet with the boundary value
+    // stored in the ghost cell
+    GpuArray<int, AMREX_SPACEDIM> bc_lo;
+    GpuArray<int, AMREX_SPACEDIM> bc_hi;
+    // coefficient of the component on the current tile
+    Array4<const Real> coeff;
+};
+}  // namespace
+
 ////////////////////////////////////////////////////////////////////////////
 // Compute the quantity: thermal = del dot kappa grad T
 //
@@ -19,111 +37,37 @@ void Maestro::MakeExplicitThermal(
     const BaseState<Real>& p0, int temp_formulation) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeExplicitThermal()", MakeExplicitThermal);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        thermal[lev].setVal(0.);
-    }
-
-    // Variable to store values to be acted upon by (div B grad) operator
-    Vector<MultiFab> phi(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        phi[lev].define(grids[lev], dmap[lev], 1, 1);
-        phi[lev].setVal(0.);
-    }
-
-    // temporary residual variable
-    Vector<MultiFab> resid(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        resid[lev].define(grids[lev], dmap[lev], 1, 0);
-        resid[lev].setVal(0.);
-    }
-
-    //
-    // Compute thermal = div B grad phi using MLABecLaplacian class
-    //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::thermal);
 
     if (temp_formulation == 1) {
         // compute div Tcoeff grad T
-        // alpha is set to zero
-        mlabec.setScalars(0.0, 1.0);
-
-        // set value of phi
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab::Copy(phi[lev], scal[lev], Temp, 0, 1, 1);
-        }
-
-        ApplyThermal(mlabec, resid, Tcoeff, phi, bcs_s, RhoH);
+        ApplyThermal(thermal, scal, {Temp}, {{&Tcoeff, 0}}, {bcs_s[Temp]});
 
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-                MultiFab::Add(thermal[lev], resid[lev], 0, 0, 1, 0);
-            }
-        }
     } else {  // if temp_formulation == 2
 
-        // 1. Compute div hcoeff grad h
-        mlabec.setScalars(0.0, 1.0);
-
-        // set value of phi
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab::Copy(phi[lev], scal[lev], RhoH, 0, 1, 1);
-            MultiFab::Divide(phi[lev], scal[lev], Rho, 0, 1, 1);
-        }
-
-        ApplyThermal(mlabec, resid, hcoeff, phi, bcs_s, RhoH);
-
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab::Add(thermal[lev], resid[lev], 0, 0, 1, 0);
-        }
-
-        // 2. Compute div Xkcoeff grad Xk
-        mlabec.setScalars(0.0, 1.0);
-
-        // temporary Xk coeff variable
-        Vector<MultiFab> Xicoeff(finest_level + 1);
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            Xicoeff[lev].define(grids[lev], dmap[lev], 1, 1);
-        }
-
-        for (int nspec = FirstSpec; nspec < FirstSpec + NumSpec; ++nspec) {
-            // set value of phi
-            for (int lev = 0; lev <= finest_level; ++lev) {
-                MultiFab::Copy(phi[lev], scal[lev], nspec, 0, 1, 1);
-                MultiFab::Divide(phi[lev], scal[lev], Rho, 0, 1, 1);
-                MultiFab::Copy(Xicoeff[lev], Xkcoeff[lev], nspec - FirstSpec, 0,
-                               1, 1);
-            }
-
-            ApplyThermal(mlabec, resid, Xicoeff, phi, bcs_s, nspec);
-
-            for (int lev = 0; lev <= finest_level; ++lev) {
-                MultiFab::Add(thermal[lev], resid[lev], 0, 0, 1, 0);
-            }
+        // all the terms
+        //   div hcoeff grad h, div Xkcoeff grad Xk, and div pcoeff grad p0
+        // are summed in a single pass over the faces
+        const int ncomp = NumSpec + 2;
+        const int p0_comp = NumSpec + 1;
+
+        Vector<int> phi_comp(ncomp);
+        Vector<std::pair<const Vector<MultiFab>*, int> > coeff(ncomp);
+        Vector<BCRec> bcs_phi(ncomp);
+
+        phi_comp[0] = RhoH;
+        coeff[0] = {&hcoeff, 0};
+        bcs_phi[0] = bcs_s[RhoH];
+        for (int comp = 0; comp < NumSpec; ++comp) {
+            phi_comp[1 + comp] = FirstSpec + comp;
+            coeff[1 + comp] = {&Xkcoeff, comp};
+            bcs_phi[1 + comp] = bcs_s[FirstSpec + comp];
         }
+        phi_comp[p0_comp] = -1;
+        coeff[p0_comp] = {&pcoeff, 0};
+        bcs_phi[p0_comp] = bcs_f[0];
 
-        // 3. Compute div pcoeff grad p0
-        mlabec.setScalars(0.0, 1.0);
-
-        // set value of phi
-        Put1dArrayOnCart(p0, phi, false, false, bcs_f, 0);
-        FillPatch(t_old, phi, phi, phi, 0, 0, 1, 0, bcs_f);
-
-        ApplyThermal(mlabec, resid, pcoeff, phi, bcs_f, 0);
-
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab::Add(thermal[lev], resid[lev], 0, 0, 1, 0);
-        }
+        ApplyThermal(thermal, scal, phi_comp, coeff, bcs_phi, &p0);
     }  // end if
 }
 
@@ -133,133 +77,212 @@ void Maestro::MakeExplicitThermalHterm(Vector<MultiFab>& thermal,
                                        const Vector<MultiFab>& hcoeff) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeExplicitThermalH()", MakeExplicitThermalH);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::thermal);
 
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        thermal[lev].setVal(0.);
-    }
+    // compute div hcoeff grad h
+    ApplyThermal(thermal, scal, {RhoH}, {{&hcoeff, 0}}, {bcs_s[RhoH]});
+}
 
-    // Variable to store values to be acted upon by (div B grad) operator
-    Vector<MultiFab> phi(finest_level + 1);
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        phi[lev].define(grids[lev], dmap[lev], 1, 1);
-        phi[lev].setVal(0.);
-    }
+// compute thermal = - sum_n div(coeff_n grad phi_n) over the phi_n
+// selected by phi_comp. This is what MLABecLaplacian::apply() gives for
+// each phi_n with alpha = 0, beta = 1, and harmonically averaged face
+// coefficients, but all the terms are summed into one flux as we sweep
+// the faces. The phi_n are evaluated from scal (and p0) on the fly.
+void Maestro::ApplyThermal(
+    Vector<MultiFab>& thermal, const Vector<MultiFab>& scal,
+    const Vector<int>& phi_comp,
+    const Vector<std::pair<const Vector<MultiFab>*, int> >& coeff,
+    const Vector<BCRec>& bcs, const BaseState<Real>* p0) {
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::ApplyThermal()", ApplyThermal);
 
-    // temporary residual variable
-    Vector<MultiFab> resid(finest_level + 1);
+    const int ncomp = phi_comp.size();
+    AMREX_ASSERT(coeff.size() == ncomp && bcs.size() == ncomp);
+
+    // skip the components whose coefficient is zero everywhere, e.g.
+    // the h term when ThermalConduct passes in a zero hcoeff
+    Vector<Real> coeff_max(ncomp, 0.0);
     for (int lev = 0; lev <= finest_level; ++lev) {
-        resid[lev].define(grids[lev], dmap[lev], 1, 0);
-        resid[lev].setVal(0.);
+        for (int n = 0; n < ncomp; ++n) {
+            const MultiFab& c = (*coeff[n].first)[lev];
+            coeff_max[n] = amrex::max(coeff_max[n],
+                                      c.norm0(coeff[n].second, 1, true));
+        }
     }
+    ParallelDescriptor::ReduceRealMax(coeff_max.dataPtr(), ncomp);
 
-    //
-    // Compute thermal = div B grad phi using MLABecLaplacian class
-    //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
+    Vector<ThermalComp> active;
+    bool any_per_mass = false;
+    for (int n = 0; n < ncomp; ++n) {
+        if (coeff_max[n] > 0.0) {
+            AMREX_ASSERT(phi_comp[n] >= 0 || p0 != nullptr);
 
-    // Only pass up to defined level to prevent looping over undefined grids.
-    MLABecLaplacian mlabec(Geom(0, finest_level), grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
-
-    // 1. Compute div hcoeff grad h
-    mlabec.setScalars(0.0, 1.0);
+            ThermalComp tc;
+            tc.n = n;
+            tc.scal_comp = phi_comp[n];
+            tc.per_mass = phi_comp[n] >= 0 && phi_comp[n] != Temp;
+            any_per_mass = any_per_mass || tc.per_mass;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                if (Geom(0).isPeriodic(idim)) {
+                    tc.bc_lo[idim] = 0;
+                    tc.bc_hi[idim] = 0;
+                } else {
+                    tc.bc_lo[idim] = bcs[n].lo(idim) == BCType::ext_dir ? 2 : 1;
+                    tc.bc_hi[idim] = bcs[n].hi(idim) == BCType::ext_dir ? 2 : 1;
+                }
+            }
+            active.push_back(tc);
+        }
+    }
+    const int nactive = active.size();
 
-    // set value of phi
+    // sum_n coeff_n grad phi_n on faces
+    Vector<std::array<MultiFab, AMREX_SPACEDIM> > flux(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
-        MultiFab::Copy(phi[lev], scal[lev], RhoH, 0, 1, 1);
-        MultiFab::Divide(phi[lev], scal[lev], Rho, 0, 1, 1);
+        AMREX_D_TERM(flux[lev][0].define(convert(grids[lev], nodal_flag_x),
+                                         dmap[lev], 1, 0);
+                     , flux[lev][1].define(convert(grids[lev], nodal_flag_y),
+                                           dmap[lev], 1, 0);
+                     , flux[lev][2].define(convert(grids[lev], nodal_flag_z),
+                                           dmap[lev], 1, 0););
     }
 
-    ApplyThermal(mlabec, resid, hcoeff, phi, bcs_s, RhoH);
-
     for (int lev = 0; lev <= finest_level; ++lev) {
-        MultiFab::Add(thermal[lev], resid[lev], 0, 0, 1, 0);
-    }
-}
+        const auto dx = geom[lev].CellSizeArray();
+        const Box& domain = geom[lev].Domain();
+        const auto domlo = domain.loVect3d();
+        const auto domhi = domain.hiVect3d();
 
-// Use apply() to construct the form of the conduction term.
-// apply() forms the generic quantity:
-//
-//   (alpha * A - beta * div B grad) phi = RHS
-void Maestro::ApplyThermal(MLABecLaplacian& mlabec,
-                           Vector<MultiFab>& thermalout,
-                           const Vector<MultiFab>& coeff, Vector<MultiFab>& phi,
-                           const Vector<BCRec>& bcs, int bccomp) {
-    // timer for profiling
-    BL_PROFILE_VAR("Maestro::ApplyThermal()", ApplyThermal);
+        // p0 is interpolated to the cell centers as it is needed
+        const auto p0_cart =
+            p0 != nullptr ? MakeBaseStateCartView(lev, *p0)
+                          : BaseStateCartView{};
 
-    // build array of boundary conditions needed by MLABecLaplacian
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType, AMREX_SPACEDIM> mlmg_hibc;
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(scal[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            const Array4<const Real> scal_arr = scal[lev].array(mfi);
 
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        } else {
-            // lo-side BCs
-            if (bcs[bccomp].lo(idim) == BCType::foextrap) {
-                // outflow
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs[bccomp].lo(idim) == BCType::ext_dir) {
-                // inflow
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
+            Vector<ThermalComp> tile_comps(active);
+            for (auto& tc : tile_comps) {
+                tc.coeff = Array4<const Real>(
+                    (*coeff[tc.n].first)[lev].array(mfi), coeff[tc.n].second);
             }
 
-            // hi-side BCs
-            if (bcs[bccomp].hi(idim) == BCType::foextrap) {
-                // outflow
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs[bccomp].hi(idim) == BCType::ext_dir) {
-                // inflow
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
+            // the kernels read the components from device memory, since
+            // with many species they would not fit in the kernel arguments
+            Gpu::AsyncArray<ThermalComp> comps_aa(tile_comps.dataPtr(),
+                                                  nactive);
+            const ThermalComp* comps = comps_aa.data();
+
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                const Box& fbx = mfi.nodaltilebox(idim);
+                const Array4<Real> flux_arr = flux[lev][idim].array(mfi);
+
+                // offset to the cell on the low side of the face
+                const int io = idim == 0;
+                const int jo = idim == 1;
+                const int ko = idim == 2;
+
+                const int flo = domlo[idim];
+                const int fhi = domhi[idim] + 1;
+                const Real dxinv = 1.0 / dx[idim];
+
+                ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                    const int f = idim == 0 ? i : (idim == 1 ? j : k);
+
+                    // h and X_k are per unit mass
+                    Real rhoinv0 = 1.0;
+                    Real rhoinv1 = 1.0;
+                    if (any_per_mass) {
+                        rhoinv0 = 1.0 / scal_arr(i - io, j - jo, k - ko, Rho);
+                        rhoinv1 = 1.0 / scal_arr(i, j, k, Rho);
+                    }
+
+                    Real fsum = 0.0;
+                    for (int m = 0; m < nactive; ++m) {
+                        const ThermalComp& tc = comps[m];
+
+                        int bc = 0;
+                        if (f == flo) {
+                            bc = tc.bc_lo[idim];
+                        } else if (f == fhi) {
+                            bc = tc.bc_hi[idim];
+                        }
+
+                        // homogeneous Neumann
+                        if (bc == 1) {
+                            continue;
+                        }
+
+                        // harmonic average of the coefficient, as in
+                        // PutDataOnFaces
+                        const Real c0 = tc.coeff(i - io, j - jo, k - ko);
+                        const Real c1 = tc.coeff(i, j, k);
+                        const Real denom = c0 + c1;
+                        const Real b =
+                            denom != 0.0 ? 2.0 * c0 * c1 / denom : 0.5 * denom;
+
+                        // the Dirichlet value sits on the face, half a
+                        // cell away from the interior cell center
+                        const Real fac = bc == 2 ? 2.0 * dxinv : dxinv;
+
+                        Real phi0, phi1;
+                        if (tc.scal_comp < 0) {
+                            phi0 = p0_cart(i - io, j - jo, k - ko);
+                            phi1 = p0_cart(i, j, k);
+                        } else {
+                            phi0 = scal_arr(i - io, j - jo, k - ko,
+                                            tc.scal_comp);
+                            phi1 = scal_arr(i, j, k, tc.scal_comp);
+                            if (tc.per_mass) {
+                                phi0 *= rhoinv0;
+                                phi1 *= rhoinv1;
+                            }
+                        }
+
+                        fsum += b * fac * (phi1 - phi0);
+                    }
+                    flux_arr(i, j, k) = fsum;
+                });
             }
         }
     }
 
-    mlabec.setDomainBC(mlmg_lobc, mlmg_hibc);
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        mlabec.setLevelBC(lev, &phi[lev]);
-    }
+    // use the fine fluxes on coarse-fine faces, so the coarse cells see
+    // the same flux as the fine ones
+    AverageDownFaces(flux);
 
-    // coefficients for solver
-    Vector<MultiFab> acoef(finest_level + 1);
-    Vector<std::array<MultiFab, AMREX_SPACEDIM> > face_bcoef(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
-        acoef[lev].define(grids[lev], dmap[lev], 1, 1);
-        AMREX_D_TERM(
-            face_bcoef[lev][0].define(convert(grids[lev], nodal_flag_x),
-                                      dmap[lev], 1, 0);
-            , face_bcoef[lev][1].define(convert(grids[lev], nodal_flag_y),
-                                        dmap[lev], 1, 0);
-            , face_bcoef[lev][2].define(convert(grids[lev], nodal_flag_z),
-                                        dmap[lev], 1, 0););
-        acoef[lev].setVal(0.);
-    }
+        const auto dx = geom[lev].CellSizeArray();
 
-    // average face-centered B coefficients
-    PutDataOnFaces(coeff, face_bcoef, true);
+        // only the valid cells are computed below
+        thermal[lev].setBndry(0.0);
 
-    // set coefficient matrix
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        mlabec.setACoeffs(lev, acoef[lev]);
-        mlabec.setBCoeffs(lev, amrex::GetArrOfConstPtrs(face_bcoef[lev]));
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(thermal[lev], TilingIfNotGPU()); mfi.isValid();
+             ++mfi) {
+            const Box& tileBox = mfi.tilebox();
+
+            const Array4<Real> thermal_arr = thermal[lev].array(mfi);
+            AMREX_D_TERM(const Array4<const Real> fx = flux[lev][0].array(mfi);
+                         , const Array4<const Real> fy = flux[lev][1].array(mfi);
+                         , const Array4<const Real> fz = flux[lev][2].array(mfi););
+
+            ParallelFor(tileBox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                thermal_arr(i, j, k) = -(AMREX_D_TERM(
+                    (fx(i + 1, j, k) - fx(i, j, k)) / dx[0],
+                    +(fy(i, j + 1, k) - fy(i, j, k)) / dx[1],
+                    +(fz(i, j, k + 1) - fz(i, j, k)) / dx[2]));
+            });
+        }
     }
 
-    // build an MLMG solver
-    MLMG thermal_mlmg(mlabec);
-
-    thermal_mlmg.apply(GetVecOfPtrs(thermalout), GetVecOfPtrs(phi));
+    // average fine data onto coarser cells
+    AverageDown(thermal, 0, 1);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -282,6 +305,10 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
         const auto buoyancy_cutoff_factor_l = buoyancy_cutoff_factor;
         const auto base_cutoff_density_l = base_cutoff_density;
 
+        // reuse the EOS outputs if they were already computed for scal
+        const MultiFab* eos_cache_lev = EOSCacheFor(scal, lev);
+        const bool use_cache = eos_cache_lev != nullptr;
+
         // loop over boxes
 #ifdef _OPENMP
 #pragma omp parallel
@@ -295,6 +322,9 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
             const Array4<Real> pcoeff_arr = pcoeff[lev].array(mfi);
             const Array4<Real> Xkcoeff_arr = Xkcoeff[lev].array(mfi);
             const Array4<const Real> scal_arr = scal[lev].array(mfi);
+            const Array4<const Real> cache_arr =
+                use_cache ? eos_cache_lev->const_array(mfi)
+                          : Array4<const Real>{};
 
             ParallelFor(gtbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
                 if (limit_conductivity_l &&
@@ -321,9 +351,16 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
                     }
 #endif
 
-                    // dens, temp and xmass are inputs
-                    eos(eos_input_rt, eos_state);
-                    conductivity(eos_state);
+                    eos_xderivs_t eos_xderivs;
+                    if (use_cache) {
+                        EOSCache::Load(cache_arr, i, j, k, eos_state);
+                        eos_xderivs = EOSCache::LoadXderivs(cache_arr, i, j, k);
+                    } else {
+                        // dens, temp and xmass are inputs
+                        eos(eos_input_rt, eos_state);
+                        conductivity(eos_state);
+                        eos_xderivs = composition_derivatives(eos_state);
+                    }
 
                     Tcoeff_arr(i, j, k) = -eos_state.conductivity;
                     hcoeff_arr(i, j, k) =
@@ -335,8 +372,6 @@ void Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
                               eos_state.p / (eos_state.rho * eos_state.dpdr)) +
                          eos_state.dedr / eos_state.dpdr);
 
-                    const auto eos_xderivs = composition_derivatives(eos_state);
-
                     for (auto comp = 0; comp < NumSpec; ++comp) {
                         Xkcoeff_arr(i, j, k, comp) = eos_state.conductivity /
                                                      eos_state.cp *
@@ -362,6 +397,7 @@ void Maestro::ThermalConduct(const Vector<MultiFab>& s1, Vector<MultiFab>& s2,
                              const Vector<MultiFab>& pcoeff2) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::ThermalConduct()", ThermalConduct);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::thermal);
 
     // Dummy coefficient matrix, holds all zeros
     Vector<MultiFab> Dcoeff(finest_level + 1);
@@ -533,6 +569,7 @@ void Maestro::ThermalConductSDC(
     const Vector<MultiFab>& pcoeff2) {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::ThermalConductSDC()", ThermalConductSDC);
+    PhaseTimer::Scope phase_scope(phase_timer, PhaseTimer::thermal);
 
     // Dummy coefficient matrix, holds all zeros
     Vector<MultiFab> Dcoeff(finest_level + 1);
@@ -1,4 +1,5 @@
 #include <Maestro.H>
+#include <MaestroParallelForBC.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -12,6 +13,41 @@ void Maestro::VelPred(
     // timer for profiling
     BL_PROFILE_VAR("Maestro::VelPred()", VelPred);
 
+    // The PPM profiles (or slopes) and the interface and transverse states
+    // of a tile live in a scratch FAB covering the tile plus one ghost
+    // cell, so they stay in cache between the stages of the predictor.
+    // Each thread keeps its scratch FABs from one tile to the next, so on
+    // the CPU they are only reallocated when a tile is larger than the ones
+    // before it (on the GPU the Elixir frees them after the tile).
+
+    // components of the tile scratch space
+    constexpr int iIpu = 0;
+    constexpr int iImu = iIpu + AMREX_SPACEDIM;
+    constexpr int iIpv = iImu + AMREX_SPACEDIM;
+    constexpr int iImv = iIpv + AMREX_SPACEDIM;
+    constexpr int iulx = iImv + AMREX_SPACEDIM;
+    constexpr int iurx = iulx + AMREX_SPACEDIM;
+    constexpr int iuimhx = iurx + AMREX_SPACEDIM;
+    constexpr int iuly = iuimhx + AMREX_SPACEDIM;
+    constexpr int iury = iuly + AMREX_SPACEDIM;
+    constexpr int iuimhy = iury + AMREX_SPACEDIM;
+#if (AMREX_SPACEDIM == 2)
+    constexpr int nscratch = iuimhy + AMREX_SPACEDIM;
+#else
+    constexpr int iIpw = iuimhy + AMREX_SPACEDIM;
+    constexpr int iImw = iIpw + AMREX_SPACEDIM;
+    constexpr int iulz = iImw + AMREX_SPACEDIM;
+    constexpr int iurz = iulz + AMREX_SPACEDIM;
+    constexpr int iuimhz = iurz + AMREX_SPACEDIM;
+    constexpr int iuimhyz = iuimhz + AMREX_SPACEDIM;
+    constexpr int iuimhzy = iuimhyz + 1;
+    constexpr int ivimhxz = iuimhzy + 1;
+    constexpr int ivimhzx = ivimhxz + 1;
+    constexpr int iwimhxy = ivimhzx + 1;
+    constexpr int iwimhyx = iwimhxy + 1;
+    constexpr int nscratch = iwimhyx + 1;
+#endif
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         // Get the index space and grid spacing of the domain
         const Box& domainBox = geom[lev].Domain();
@@ -24,266 +60,214 @@ void Maestro::VelPred(
         const MultiFab& utrans_mf = utrans[lev][0];
         const MultiFab& vtrans_mf = utrans[lev][1];
         MultiFab& vmac_mf = umac[lev][1];
-
-        MultiFab Ipu, Imu, Ipv, Imv;
-        Ipu.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imu.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Ipv.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imv.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab Ipfx, Imfx, Ipfy, Imfy;
-        Ipfx.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imfx.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Ipfy.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imfy.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab ulx, urx, uimhx, uly, ury, uimhy;
-        ulx.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        urx.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        uimhx.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        uly.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        ury.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        uimhy.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
 #if (AMREX_SPACEDIM == 3)
         const MultiFab& wtrans_mf = utrans[lev][2];
         MultiFab& wmac_mf = umac[lev][2];
         const MultiFab& w0macx_mf = w0mac[lev][0];
         const MultiFab& w0macy_mf = w0mac[lev][1];
         const MultiFab& w0macz_mf = w0mac[lev][2];
-
-        MultiFab Ipw, Imw;
-        Ipw.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imw.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab Ipfz, Imfz;
-        Ipfz.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        Imfz.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab ulz, urz, uimhz;
-        ulz.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        urz.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-        uimhz.define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
-
-        MultiFab uimhyz, uimhzy, vimhxz, vimhzx, wimhxy, wimhyx;
-        uimhyz.define(grids[lev], dmap[lev], 1, 1);
-        uimhzy.define(grids[lev], dmap[lev], 1, 1);
-        vimhxz.define(grids[lev], dmap[lev], 1, 1);
-        vimhzx.define(grids[lev], dmap[lev], 1, 1);
-        wimhxy.define(grids[lev], dmap[lev], 1, 1);
-        wimhyx.define(grids[lev], dmap[lev], 1, 1);
 #endif
         const MultiFab& force_mf = force[lev];
         const MultiFab& w0_mf = w0_cart[lev];
 
-#if (AMREX_SPACEDIM == 2)
-
-        MultiFab u_mf, v_mf;
-
-        if (ppm_type == 0) {
-            u_mf.define(grids[lev], dmap[lev], 1, utilde[lev].nGrow());
-            v_mf.define(grids[lev], dmap[lev], 1, utilde[lev].nGrow());
-
-            MultiFab::Copy(u_mf, utilde[lev], 0, 0, 1, utilde[lev].nGrow());
-            MultiFab::Copy(v_mf, utilde[lev], 1, 0, 1, utilde[lev].nGrow());
-
-        } else if (ppm_type == 1 || ppm_type == 2) {
-            u_mf.define(grids[lev], dmap[lev], 1, ufull[lev].nGrow());
-            v_mf.define(grids[lev], dmap[lev], 1, ufull[lev].nGrow());
-
-            MultiFab::Copy(u_mf, ufull[lev], 0, 0, 1, ufull[lev].nGrow());
-            MultiFab::Copy(v_mf, ufull[lev], 1, 0, 1, ufull[lev].nGrow());
-        }
-
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(utilde_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            // Get the index space of the valid region
-            const Box& obx = amrex::grow(mfi.tilebox(), 1);
-
-            if (ppm_type == 0) {
-                // we're going to reuse Ip here as slopex as it has the
-                // correct number of ghost zones
-                Slopex(obx, utilde_mf.array(mfi), Ipu.array(mfi), domainBox,
-                       bcs_u, AMREX_SPACEDIM, 0);
-            } else {
-                PPM(obx, utilde_mf.array(mfi), u_mf.array(mfi), v_mf.array(mfi),
-                    Ipu.array(mfi), Imu.array(mfi), domainBox, bcs_u, dx, false,
-                    0, 0);
+        {
+            // the scratch space of this thread, reused for each of its tiles
+            FArrayBox scratch;
+            FArrayBox force_scratch;
+
+            for (MFIter mfi(utilde_mf, TilingIfNotGPU()); mfi.isValid();
+                 ++mfi) {
+                // Get the index space of the valid region
+                const Box& obx = amrex::grow(mfi.tilebox(), 1);
+
+                Array4<Real> const utilde_arr = utilde_mf.array(mfi);
+                const auto ufull_arr = ufull_mf.const_array(mfi);
+                const auto force_arr = force_mf.const_array(mfi);
+
+                // the components of the full velocity, used by PPM
+                Array4<const Real> const u_arr(ufull_arr, 0);
+                Array4<const Real> const v_arr(ufull_arr, 1);
+#if (AMREX_SPACEDIM == 3)
+                Array4<const Real> const w_arr(ufull_arr, 2);
+#endif
 
-                if (ppm_trace_forces == 1) {
-                    PPM(obx, force_mf.array(mfi), u_mf.array(mfi),
-                        v_mf.array(mfi), Ipfx.array(mfi), Imfx.array(mfi),
-                        domainBox, bcs_u, dx, false, 0, 0);
-                }
-            }
+                scratch.resize(obx, nscratch);
+                Elixir e_scratch = scratch.elixir();
+
+                const auto scratch_arr = scratch.array();
+
+                Array4<Real> const Ipu(scratch_arr, iIpu);
+                Array4<Real> const Imu(scratch_arr, iImu);
+                Array4<Real> const Ipv(scratch_arr, iIpv);
+                Array4<Real> const Imv(scratch_arr, iImv);
 
-            if (ppm_type == 0) {
-                // we're going to reuse Im here as slopey as it has the
-                // correct number of ghost zones
-                Slopey(obx, utilde_mf.array(mfi), Imv.array(mfi), domainBox,
-                       bcs_u, AMREX_SPACEDIM, 0);
-            } else {
-                PPM(obx, utilde_mf.array(mfi), u_mf.array(mfi), v_mf.array(mfi),
-                    Ipv.array(mfi), Imv.array(mfi), domainBox, bcs_u, dx, false,
-                    1, 1);
+                Array4<Real> const ulx(scratch_arr, iulx);
+                Array4<Real> const urx(scratch_arr, iurx);
+                Array4<Real> const uimhx(scratch_arr, iuimhx);
+                Array4<Real> const uly(scratch_arr, iuly);
+                Array4<Real> const ury(scratch_arr, iury);
+                Array4<Real> const uimhy(scratch_arr, iuimhy);
+#if (AMREX_SPACEDIM == 3)
+                Array4<Real> const Ipw(scratch_arr, iIpw);
+                Array4<Real> const Imw(scratch_arr, iImw);
+
+                Array4<Real> const ulz(scratch_arr, iulz);
+                Array4<Real> const urz(scratch_arr, iurz);
+                Array4<Real> const uimhz(scratch_arr, iuimhz);
+
+                Array4<Real> const uimhyz(scratch_arr, iuimhyz);
+                Array4<Real> const uimhzy(scratch_arr, iuimhzy);
+                Array4<Real> const vimhxz(scratch_arr, ivimhxz);
+                Array4<Real> const vimhzx(scratch_arr, ivimhzx);
+                Array4<Real> const wimhxy(scratch_arr, iwimhxy);
+                Array4<Real> const wimhyx(scratch_arr, iwimhyx);
+#endif
 
+                // the traced forces are only needed with ppm_trace_forces
+                Elixir e_force_scratch;
+                Array4<Real> Ipfx, Imfx, Ipfy, Imfy;
+#if (AMREX_SPACEDIM == 3)
+                Array4<Real> Ipfz, Imfz;
+#endif
                 if (ppm_trace_forces == 1) {
-                    PPM(obx, force_mf.array(mfi), u_mf.array(mfi),
-                        v_mf.array(mfi), Ipv.array(mfi), Imv.array(mfi),
-                        domainBox, bcs_u, dx, false, 1, 1);
+                    force_scratch.resize(obx,
+                                         2 * AMREX_SPACEDIM * AMREX_SPACEDIM);
+                    e_force_scratch = force_scratch.elixir();
+                    const auto force_scratch_arr = force_scratch.array();
+                    Ipfx = Array4<Real>(force_scratch_arr, 0);
+                    Imfx = Array4<Real>(force_scratch_arr, AMREX_SPACEDIM);
+                    Ipfy = Array4<Real>(force_scratch_arr, 2 * AMREX_SPACEDIM);
+                    Imfy = Array4<Real>(force_scratch_arr, 3 * AMREX_SPACEDIM);
+#if (AMREX_SPACEDIM == 3)
+                    Ipfz = Array4<Real>(force_scratch_arr, 4 * AMREX_SPACEDIM);
+                    Imfz = Array4<Real>(force_scratch_arr, 5 * AMREX_SPACEDIM);
+#endif
                 }
-            }
 
-            Gpu::synchronize();
+#if (AMREX_SPACEDIM == 2)
+                if (ppm_type == 0) {
+                    // we're going to reuse Ip here as slopex as it has the
+                    // correct number of ghost zones
+                    Slopex(obx, utilde_arr, Ipu, domainBox, bcs_u,
+                           AMREX_SPACEDIM, 0);
+                } else {
+                    PPM(obx, utilde_arr, u_arr, v_arr, Ipu, Imu, domainBox,
+                        bcs_u, dx, false, 0, 0);
+
+                    if (ppm_trace_forces == 1) {
+                        PPM(obx, force_arr, u_arr, v_arr, Ipfx, Imfx,
+                            domainBox, bcs_u, dx, false, 0, 0);
+                    }
+                }
 
-            VelPredInterface(mfi, utilde_mf.array(mfi), ufull_mf.array(mfi),
-                             utrans_mf.array(mfi), vtrans_mf.array(mfi),
-                             Imu.array(mfi), Ipu.array(mfi), Imv.array(mfi),
-                             Ipv.array(mfi), ulx.array(mfi), urx.array(mfi),
-                             uimhx.array(mfi), uly.array(mfi), ury.array(mfi),
-                             uimhy.array(mfi), domainBox, dx);
+                if (ppm_type == 0) {
+                    // we're going to reuse Im here as slopey as it has the
+                    // correct number of ghost zones
+                    Slopey(obx, utilde_arr, Imv, domainBox, bcs_u,
+                           AMREX_SPACEDIM, 0);
+                } else {
+                    PPM(obx, utilde_arr, u_arr, v_arr, Ipv, Imv, domainBox,
+                        bcs_u, dx, false, 1, 1);
+
+                    if (ppm_trace_forces == 1) {
+                        PPM(obx, force_arr, u_arr, v_arr, Ipfy, Imfy,
+                            domainBox, bcs_u, dx, false, 1, 1);
+                    }
+                }
 
-            Gpu::synchronize();
+                VelPredInterface(mfi, utilde_arr, ufull_arr,
+                                 utrans_mf.array(mfi), vtrans_mf.array(mfi),
+                                 Imu, Ipu, Imv, Ipv, ulx, urx, uimhx, uly, ury,
+                                 uimhy, domainBox, dx);
 
-            VelPredVelocities(mfi, utilde_mf.array(mfi), utrans_mf.array(mfi),
-                              vtrans_mf.array(mfi), umac_mf.array(mfi),
-                              vmac_mf.array(mfi), Imfx.array(mfi),
-                              Ipfx.array(mfi), Imfy.array(mfi), Ipfy.array(mfi),
-                              ulx.array(mfi), urx.array(mfi), uimhx.array(mfi),
-                              uly.array(mfi), ury.array(mfi), uimhy.array(mfi),
-                              force_mf.array(mfi), w0_mf.array(mfi), domainBox,
-                              dx);
-        }  // end MFIter loop
+                VelPredVelocities(mfi, utilde_arr, utrans_mf.array(mfi),
+                                  vtrans_mf.array(mfi), umac_mf.array(mfi),
+                                  vmac_mf.array(mfi), Imfx, Ipfx, Imfy, Ipfy,
+                                  ulx, urx, uimhx, uly, ury, uimhy, force_arr,
+                                  w0_mf.array(mfi), domainBox, dx);
 
 #elif (AMREX_SPACEDIM == 3)
+                // x-direction
+                if (ppm_type == 0) {
+                    // we're going to reuse Ipu here as slopex as it has the
+                    // correct number of ghost zones
+                    Slopex(obx, utilde_arr, Ipu, domainBox, bcs_u,
+                           AMREX_SPACEDIM, 0);
+
+                } else {
+                    PPM(obx, utilde_arr, u_arr, v_arr, w_arr, Ipu, Imu,
+                        domainBox, bcs_u, dx, false, 0, 0);
 
-        MultiFab u_mf, v_mf, w_mf;
-
-        if (ppm_type == 0) {
-            u_mf.define(grids[lev], dmap[lev], 1, utilde[lev].nGrow());
-            v_mf.define(grids[lev], dmap[lev], 1, utilde[lev].nGrow());
-            w_mf.define(grids[lev], dmap[lev], 1, utilde[lev].nGrow());
-
-            MultiFab::Copy(u_mf, utilde[lev], 0, 0, 1, utilde[lev].nGrow());
-            MultiFab::Copy(v_mf, utilde[lev], 1, 0, 1, utilde[lev].nGrow());
-            MultiFab::Copy(w_mf, utilde[lev], 2, 0, 1, utilde[lev].nGrow());
-
-        } else if (ppm_type == 1 || ppm_type == 2) {
-            u_mf.define(grids[lev], dmap[lev], 1, ufull[lev].nGrow());
-            v_mf.define(grids[lev], dmap[lev], 1, ufull[lev].nGrow());
-            w_mf.define(grids[lev], dmap[lev], 1, ufull[lev].nGrow());
-
-            MultiFab::Copy(u_mf, ufull[lev], 0, 0, 1, ufull[lev].nGrow());
-            MultiFab::Copy(v_mf, ufull[lev], 1, 0, 1, ufull[lev].nGrow());
-            MultiFab::Copy(w_mf, ufull[lev], 2, 0, 1, ufull[lev].nGrow());
-        }
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-        for (MFIter mfi(utilde_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            // Get the index space of the valid region
-            const Box& obx = amrex::grow(mfi.tilebox(), 1);
-
-            // x-direction
-            if (ppm_type == 0) {
-                // we're going to reuse Ipu here as slopex as it has the
-                // correct number of ghost zones
-                Slopex(obx, utilde_mf.array(mfi), Ipu.array(mfi), domainBox,
-                       bcs_u, AMREX_SPACEDIM, 0);
-
-            } else {
-                PPM(obx, utilde_mf.array(mfi), u_mf.array(mfi), v_mf.array(mfi),
-                    w_mf.array(mfi), Ipu.array(mfi), Imu.array(mfi), domainBox,
-                    bcs_u, dx, false, 0, 0);
-
-                if (ppm_trace_forces == 1) {
-                    PPM(obx, force_mf.array(mfi), u_mf.array(mfi),
-                        v_mf.array(mfi), w_mf.array(mfi), Ipfx.array(mfi),
-                        Imfx.array(mfi), domainBox, bcs_u, dx, false, 0, 0);
+                    if (ppm_trace_forces == 1) {
+                        PPM(obx, force_arr, u_arr, v_arr, w_arr, Ipfx, Imfx,
+                            domainBox, bcs_u, dx, false, 0, 0);
+                    }
                 }
-            }
 
-            // y-direction
-            if (ppm_type == 0) {
-                // we're going to reuse Imv here as slopey as it has the
-                // correct number of ghost zones
-                Slopey(obx, utilde_mf.array(mfi), Imv.array(mfi), domainBox,
-                       bcs_u, AMREX_SPACEDIM, 0);
+                // y-direction
+                if (ppm_type == 0) {
+                    // we're going to reuse Imv here as slopey as it has the
+                    // correct number of ghost zones
+                    Slopey(obx, utilde_arr, Imv, domainBox, bcs_u,
+                           AMREX_SPACEDIM, 0);
 
-            } else {
-                PPM(obx, utilde_mf.array(mfi), u_mf.array(mfi), v_mf.array(mfi),
-                    w_mf.array(mfi), Ipv.array(mfi), Imv.array(mfi), domainBox,
-                    bcs_u, dx, false, 1, 1);
+                } else {
+                    PPM(obx, utilde_arr, u_arr, v_arr, w_arr, Ipv, Imv,
+                        domainBox, bcs_u, dx, false, 1, 1);
 
-                if (ppm_trace_forces == 1) {
-                    PPM(obx, force_mf.array(mfi), u_mf.array(mfi),
-                        v_mf.array(mfi), w_mf.array(mfi), Ipfy.array(mfi),
-                        Imfy.array(mfi), domainBox, bcs_u, dx, false, 1, 1);
+                    if (ppm_trace_forces == 1) {
+                        PPM(obx, force_arr, u_arr, v_arr, w_arr, Ipfy, Imfy,
+                            domainBox, bcs_u, dx, false, 1, 1);
+                    }
                 }
-            }
 
-            // z-direction
-            if (ppm_type == 0) {
-                // we're going to reuse Imw here as slopey as it has the
-                // correct number of ghost zones
+                // z-direction
+                if (ppm_type == 0) {
+                    // we're going to reuse Imw here as slopey as it has the
+                    // correct number of ghost zones
 
-                Slopez(obx, utilde_mf.array(mfi), Imw.array(mfi), domainBox,
-                       bcs_u, AMREX_SPACEDIM, 0);
+                    Slopez(obx, utilde_arr, Imw, domainBox, bcs_u,
+                           AMREX_SPACEDIM, 0);
 
-            } else {
-                PPM(obx, utilde_mf.array(mfi), u_mf.array(mfi), v_mf.array(mfi),
-                    w_mf.array(mfi), Ipw.array(mfi), Imw.array(mfi), domainBox,
-                    bcs_u, dx, false, 2, 2);
+                } else {
+                    PPM(obx, utilde_arr, u_arr, v_arr, w_arr, Ipw, Imw,
+                        domainBox, bcs_u, dx, false, 2, 2);
 
-                if (ppm_trace_forces == 1) {
-                    PPM(obx, force_mf.array(mfi), u_mf.array(mfi),
-                        v_mf.array(mfi), w_mf.array(mfi), Ipfz.array(mfi),
-                        Imfz.array(mfi), domainBox, bcs_u, dx, false, 2, 2);
+                    if (ppm_trace_forces == 1) {
+                        PPM(obx, force_arr, u_arr, v_arr, w_arr, Ipfz, Imfz,
+                            domainBox, bcs_u, dx, false, 2, 2);
+                    }
                 }
-            }
-
-            Gpu::synchronize();
-
-            VelPredInterface(mfi, utilde_mf.array(mfi), ufull_mf.array(mfi),
-                             utrans_mf.array(mfi), vtrans_mf.array(mfi),
-                             wtrans_mf.array(mfi), Imu.array(mfi),
-                             Ipu.array(mfi), Imv.array(mfi), Ipv.array(mfi),
-                             Imw.array(mfi), Ipw.array(mfi), ulx.array(mfi),
-                             urx.array(mfi), uimhx.array(mfi), uly.array(mfi),
-                             ury.array(mfi), uimhy.array(mfi), ulz.array(mfi),
-                             urz.array(mfi), uimhz.array(mfi), domainBox, dx);
-
-            Gpu::synchronize();
-
-            VelPredTransverse(
-                mfi, utilde_mf.array(mfi), utrans_mf.array(mfi),
-                vtrans_mf.array(mfi), wtrans_mf.array(mfi), ulx.array(mfi),
-                urx.array(mfi), uimhx.array(mfi), uly.array(mfi),
-                ury.array(mfi), uimhy.array(mfi), ulz.array(mfi),
-                urz.array(mfi), uimhz.array(mfi), uimhyz.array(mfi),
-                uimhzy.array(mfi), vimhxz.array(mfi), vimhzx.array(mfi),
-                wimhxy.array(mfi), wimhyx.array(mfi), domainBox, dx);
-
-            Gpu::synchronize();
-
-            VelPredVelocities(
-                mfi, utilde_mf.array(mfi), utrans_mf.array(mfi),
-                vtrans_mf.array(mfi), wtrans_mf.array(mfi), umac_mf.array(mfi),
-                vmac_mf.array(mfi), wmac_mf.array(mfi), w0macx_mf.array(mfi),
-                w0macy_mf.array(mfi), w0macz_mf.array(mfi), Imfx.array(mfi),
-                Ipfx.array(mfi), Imfy.array(mfi), Ipfy.array(mfi),
-                Imfz.array(mfi), Ipfz.array(mfi), ulx.array(mfi),
-                urx.array(mfi), uly.array(mfi), ury.array(mfi), ulz.array(mfi),
-                urz.array(mfi), uimhyz.array(mfi), uimhzy.array(mfi),
-                vimhxz.array(mfi), vimhzx.array(mfi), wimhxy.array(mfi),
-                wimhyx.array(mfi), force_mf.array(mfi), w0_mf.array(mfi),
-                domainBox, dx);
-        }  // end MFIter loop
 
+                VelPredInterface(mfi, utilde_arr, ufull_arr,
+                                 utrans_mf.array(mfi), vtrans_mf.array(mfi),
+                                 wtrans_mf.array(mfi), Imu, Ipu, Imv, Ipv, Imw,
+                                 Ipw, ulx, urx, uimhx, uly, ury, uimhy, ulz,
+                                 urz, uimhz, domainBox, dx);
+
+                VelPredTransverse(
+                    mfi, utilde_arr, utrans_mf.array(mfi),
+                    vtrans_mf.array(mfi), wtrans_mf.array(mfi), ulx, urx,
+                    uimhx, uly, ury, uimhy, ulz, urz, uimhz, uimhyz, uimhzy,
+                    vimhxz, vimhzx, wimhxy, wimhyx, domainBox, dx);
+
+                VelPredVelocities(
+                    mfi, utilde_arr, utrans_mf.array(mfi),
+                    vtrans_mf.array(mfi), wtrans_mf.array(mfi),
+                    umac_mf.array(mfi), vmac_mf.array(mfi), wmac_mf.array(mfi),
+                    w0macx_mf.array(mfi), w0macy_mf.array(mfi),
+                    w0macz_mf.array(mfi), Imfx, Ipfx, Imfy, Ipfy, Imfz, Ipfz,
+                    ulx, urx, uly, ury, ulz, urz, uimhyz, uimhzy, vimhxz,
+                    vimhzx, wimhxy, wimhyx, force_arr, w0_mf.array(mfi),
+                    domainBox, dx);
 #endif  // AMREX_SPACEDIM
-    }   // end loop over levels
+            }  // end MFIter loop
+        }
+    }  // end loop over levels
 
     // edge_restriction
     AverageDownFaces(umac);
@@ -327,7 +311,13 @@ void Maestro::VelPredInterface(
     int bclo = phys_bc[0];
     int bchi = phys_bc[AMREX_SPACEDIM];
 
-    ParallelFor(mxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    // only boxes that reach a physical boundary need the boundary
+    // conditions imposed on the faces
+    bool has_lo_bc = bclo != Interior && mxbx.smallEnd(0) <= domlo[0];
+    bool has_hi_bc = bchi != Interior && mxbx.bigEnd(0) >= domhi[0] + 1;
+
+    const auto interface_x = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         if (ppm_type == 0) {
             Real maxu = amrex::max(0.0, ufull(i - 1, j, k, 0));
             Real minu = amrex::min(0.0, ufull(i, j, k, 0));
@@ -351,7 +341,7 @@ void Maestro::VelPredInterface(
         }
 
         // impose lo side bc's
-        if (i == domlo[0]) {
+        if (lo_bc && i == domlo[0]) {
             switch (bclo) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -382,7 +372,7 @@ void Maestro::VelPredInterface(
             }
 
             // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
+        } else if (hi_bc && i == domhi[0] + 1) {
             switch (bchi) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -421,13 +411,18 @@ void Maestro::VelPredInterface(
         uimhx(i, j, k, 1) = amrex::Math::abs(utrans(i, j, k)) < rel_eps_local
                                 ? 0.5 * (ulx(i, j, k, 1) + urx(i, j, k, 1))
                                 : uimhx(i, j, k, 1);
-    });
+    };
+    maestro::ParallelForBC(mxbx, has_lo_bc, has_hi_bc, interface_x);
 
     // y-direction
     bclo = phys_bc[1];
     bchi = phys_bc[AMREX_SPACEDIM + 1];
 
-    ParallelFor(mybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = bclo != Interior && mybx.smallEnd(1) <= domlo[1];
+    has_hi_bc = bchi != Interior && mybx.bigEnd(1) >= domhi[1] + 1;
+
+    const auto interface_y = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         if (ppm_type == 0) {
             Real maxu = amrex::max(0.0, ufull(i, j - 1, k, 1));
             Real minu = amrex::min(0.0, ufull(i, j, k, 1));
@@ -451,7 +446,7 @@ void Maestro::VelPredInterface(
         }
 
         // impose lo side bc's
-        if (j == domlo[1]) {
+        if (lo_bc && j == domlo[1]) {
             switch (bclo) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -482,7 +477,7 @@ void Maestro::VelPredInterface(
             }
 
             // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
+        } else if (hi_bc && j == domhi[1] + 1) {
             switch (bchi) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -520,7 +515,8 @@ void Maestro::VelPredInterface(
         uimhy(i, j, k, 0) = amrex::Math::abs(vtrans(i, j, k)) < rel_eps_local
                                 ? 0.5 * (uly(i, j, k, 0) + ury(i, j, k, 0))
                                 : uimhy(i, j, k, 0);
-    });
+    };
+    maestro::ParallelForBC(mybx, has_lo_bc, has_hi_bc, interface_y);
 }
 
 void Maestro::VelPredVelocities(
@@ -559,7 +555,13 @@ void Maestro::VelPredVelocities(
     int bclo = phys_bc[0];
     int bchi = phys_bc[AMREX_SPACEDIM];
 
-    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    // only boxes that reach a physical boundary need the boundary
+    // conditions imposed on the faces
+    bool has_lo_bc = bclo != Interior && xbx.smallEnd(0) <= domlo[0];
+    bool has_hi_bc = bchi != Interior && xbx.bigEnd(0) >= domhi[0] + 1;
+
+    const auto velocity_x = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
         // use the traced force if ppm_trace_forces = 1
         Real fl = ppm_trace_forces == 0 ? force(i - 1, j, k, 0)
                                         : Ipfx(i - 1, j, k, 0);
@@ -585,7 +587,7 @@ void Maestro::VelPredVelocities(
                 : umac(i, j, k);
 
         // impose lo side bc's
-        if (i == domlo[0]) {
+        if (lo_bc && i == domlo[0]) {
             switch (bclo) {
                 case Inflow:
                     umac(i, j, k) = utilde(i - 1, j, k, 0);
@@ -603,7 +605,7 @@ void Maestro::VelPredVelocities(
             }
 
             // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
+        } else if (hi_bc && i == domhi[0] + 1) {
             switch (bchi) {
                 case Inflow:
                     umac(i, j, k) = utilde(i, j, k, 0);
@@ -620,13 +622,18 @@ void Maestro::VelPredVelocities(
                     break;
             }
         }
-    });
+    };
+    maestro::ParallelForBC(xbx, has_lo_bc, has_hi_bc, velocity_x);
 
     // y-direction
     bclo = phys_bc[1];
     bchi = phys_bc[AMREX_SPACEDIM + 1];
 
-    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = bclo != Interior && ybx.smallEnd(1) <= domlo[1];
+    has_hi_bc = bchi != Interior && ybx.bigEnd(1) >= domhi[1] + 1;
+
+    const auto velocity_y = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
         // use the traced force if ppm_trace_forces = 1
         Real fl = ppm_trace_forces == 0 ? force(i, j - 1, k, 1)
                                         : Ipfy(i, j - 1, k, 1);
@@ -658,7 +665,7 @@ void Maestro::VelPredVelocities(
         vmac(i, j, k) = test ? 0.0 : vmac(i, j, k);
 
         // impose lo side bc's
-        if (j == domlo[1]) {
+        if (lo_bc && j == domlo[1]) {
             switch (bclo) {
                 case Inflow:
                     vmac(i, j, k) = utilde(i, j - 1, k, 1);
@@ -676,7 +683,7 @@ void Maestro::VelPredVelocities(
             }
 
             // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
+        } else if (hi_bc && j == domhi[1] + 1) {
             switch (bchi) {
                 case Inflow:
                     vmac(i, j, k) = utilde(i, j, k, 1);
@@ -693,7 +700,8 @@ void Maestro::VelPredVelocities(
                     break;
             }
         }
-    });
+    };
+    maestro::ParallelForBC(ybx, has_lo_bc, has_hi_bc, velocity_y);
 }
 
 #else
@@ -742,7 +750,13 @@ void Maestro::VelPredInterface(
     int bclo = phys_bc[0];
     int bchi = phys_bc[AMREX_SPACEDIM];
 
-    ParallelFor(mxbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    // only boxes that reach a physical boundary need the boundary
+    // conditions imposed on the faces
+    bool has_lo_bc = bclo != Interior && mxbx.smallEnd(0) <= domlo[0];
+    bool has_hi_bc = bchi != Interior && mxbx.bigEnd(0) >= domhi[0] + 1;
+
+    const auto interface_x = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         if (ppm_type == 0) {
             Real maxu = 0.5 - dt2 * amrex::max(0.0, ufull(i - 1, j, k, 0)) / hx;
             Real minu = 0.5 + dt2 * amrex::min(0.0, ufull(i, j, k, 0)) / hx;
@@ -767,7 +781,7 @@ void Maestro::VelPredInterface(
         }
 
         // impose lo side bc's
-        if (i == domlo[0]) {
+        if (lo_bc && i == domlo[0]) {
             switch (bclo) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -799,7 +813,7 @@ void Maestro::VelPredInterface(
             }
 
             // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
+        } else if (hi_bc && i == domhi[0] + 1) {
             switch (bchi) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -845,13 +859,18 @@ void Maestro::VelPredInterface(
         uimhx(i, j, k, 2) = amrex::Math::abs(utrans(i, j, k)) < rel_eps_local
                                 ? 0.5 * (ulx(i, j, k, 2) + urx(i, j, k, 2))
                                 : uimhx(i, j, k, 2);
-    });
+    };
+    maestro::ParallelForBC(mxbx, has_lo_bc, has_hi_bc, interface_x);
 
     // y-direction
     bclo = phys_bc[1];
     bchi = phys_bc[AMREX_SPACEDIM + 1];
 
-    ParallelFor(mybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = bclo != Interior && mybx.smallEnd(1) <= domlo[1];
+    has_hi_bc = bchi != Interior && mybx.bigEnd(1) >= domhi[1] + 1;
+
+    const auto interface_y = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         if (ppm_type == 0) {
             Real maxu =
                 (0.5 - dt2 * amrex::max(0.0, ufull(i, j - 1, k, 1)) / hy);
@@ -878,7 +897,7 @@ void Maestro::VelPredInterface(
         }
 
         // impose lo side bc's
-        if (j == domlo[1]) {
+        if (lo_bc && j == domlo[1]) {
             switch (bclo) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -910,7 +929,7 @@ void Maestro::VelPredInterface(
             }
 
             // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
+        } else if (hi_bc && j == domhi[1] + 1) {
             switch (bchi) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -956,13 +975,18 @@ void Maestro::VelPredInterface(
         uimhy(i, j, k, 2) = amrex::Math::abs(vtrans(i, j, k)) < rel_eps_local
                                 ? 0.5 * (uly(i, j, k, 2) + ury(i, j, k, 2))
                                 : uimhy(i, j, k, 2);
-    });
+    };
+    maestro::ParallelForBC(mybx, has_lo_bc, has_hi_bc, interface_y);
 
     // z-direction
     bclo = phys_bc[2];
     bchi = phys_bc[AMREX_SPACEDIM + 2];
 
-    ParallelFor(mzbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = bclo != Interior && mzbx.smallEnd(2) <= domlo[2];
+    has_hi_bc = bchi != Interior && mzbx.bigEnd(2) >= domhi[2] + 1;
+
+    const auto interface_z = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         if (ppm_type == 0) {
             Real maxu = 0.5 - dt2 * amrex::max(0.0, ufull(i, j, k - 1, 2)) / hz;
             Real minu = 0.5 + dt2 * amrex::min(0.0, ufull(i, j, k, 2)) / hz;
@@ -988,7 +1012,7 @@ void Maestro::VelPredInterface(
         }
 
         // impose lo side bc's
-        if (k == domlo[2]) {
+        if (lo_bc && k == domlo[2]) {
             switch (bclo) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -1020,7 +1044,7 @@ void Maestro::VelPredInterface(
             }
 
             // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
+        } else if (hi_bc && k == domhi[2] + 1) {
             switch (bchi) {
                 case Inflow:
                     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -1066,7 +1090,8 @@ void Maestro::VelPredInterface(
         uimhz(i, j, k, 1) = amrex::Math::abs(wtrans(i, j, k)) < rel_eps_local
                                 ? 0.5 * (ulz(i, j, k, 1) + urz(i, j, k, 1))
                                 : uimhz(i, j, k, 1);
-    });
+    };
+    maestro::ParallelForBC(mzbx, has_lo_bc, has_hi_bc, interface_z);
 }
 
 void Maestro::VelPredTransverse(
@@ -1106,7 +1131,14 @@ void Maestro::VelPredTransverse(
     Box imhbox = amrex::grow(mfi.tilebox(), 0, 1);
     imhbox = amrex::growHi(imhbox, 1, 1);
 
-    ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    // only boxes that reach a physical boundary need the boundary
+    // conditions imposed on the faces
+    bool has_lo_bc = physbc[1] != Interior && imhbox.smallEnd(1) <= domlo[1];
+    bool has_hi_bc = physbc[AMREX_SPACEDIM + 1] != Interior &&
+                     imhbox.bigEnd(1) >= domhi[1] + 1;
+
+    const auto make_uimhyz = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         // extrapolate to faces
         Real ulyz = uly(i, j, k, 0) -
                     (dt6 / hz) *
@@ -1117,7 +1149,7 @@ void Maestro::VelPredTransverse(
                         (uimhz(i, j, k + 1, 0) - uimhz(i, j, k, 0));
 
         // impose lo side bc's
-        if (j == domlo[1]) {
+        if (lo_bc && j == domlo[1]) {
             switch (physbc[1]) {
                 case Inflow:
                     ulyz = utilde(i, j - 1, k, 0);
@@ -1137,7 +1169,7 @@ void Maestro::VelPredTransverse(
             }
 
             // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
+        } else if (hi_bc && j == domhi[1] + 1) {
             switch (physbc[AMREX_SPACEDIM + 1]) {
                 case Inflow:
                     ulyz = utilde(i, j, k, 0);
@@ -1162,13 +1194,19 @@ void Maestro::VelPredTransverse(
         uimhyz(i, j, k) = amrex::Math::abs(vtrans(i, j, k)) < rel_eps_local
                               ? 0.5 * (ulyz + uryz)
                               : uimhyz(i, j, k);
-    });
+    };
+    maestro::ParallelForBC(imhbox, has_lo_bc, has_hi_bc, make_uimhyz);
 
     // uimhzy, 1, 3
     imhbox = amrex::grow(mfi.tilebox(), 0, 1);
     imhbox = amrex::growHi(imhbox, 2, 1);
 
-    ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[2] != Interior && imhbox.smallEnd(2) <= domlo[2];
+    has_hi_bc = physbc[AMREX_SPACEDIM + 2] != Interior &&
+                imhbox.bigEnd(2) >= domhi[2] + 1;
+
+    const auto make_uimhzy = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         // extrapolate to faces
         Real ulzy = ulz(i, j, k, 0) -
                     (dt6 / hy) *
@@ -1179,7 +1217,7 @@ void Maestro::VelPredTransverse(
                         (uimhy(i, j + 1, k, 0) - uimhy(i, j, k, 0));
 
         // impose lo side bc's
-        if (k == domlo[2]) {
+        if (lo_bc && k == domlo[2]) {
             switch (physbc[2]) {
                 case Inflow:
                     ulzy = utilde(i, j, k - 1, 0);
@@ -1199,7 +1237,7 @@ void Maestro::VelPredTransverse(
             }
 
             // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
+        } else if (hi_bc && k == domhi[2] + 1) {
             switch (physbc[AMREX_SPACEDIM + 2]) {
                 case Inflow:
                     ulzy = utilde(i, j, k, 0);
@@ -1224,13 +1262,19 @@ void Maestro::VelPredTransverse(
         uimhzy(i, j, k) = amrex::Math::abs(wtrans(i, j, k)) < rel_eps_local
                               ? 0.5 * (ulzy + urzy)
                               : uimhzy(i, j, k);
-    });
+    };
+    maestro::ParallelForBC(imhbox, has_lo_bc, has_hi_bc, make_uimhzy);
 
     // vimhxz, 2, 1
     imhbox = amrex::grow(mfi.tilebox(), 1, 1);
     imhbox = amrex::growHi(imhbox, 0, 1);
 
-    ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[0] != Interior && imhbox.smallEnd(0) <= domlo[0];
+    has_hi_bc = physbc[AMREX_SPACEDIM] != Interior &&
+                imhbox.bigEnd(0) >= domhi[0] + 1;
+
+    const auto make_vimhxz = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         // extrapolate to faces
         Real vlxz = ulx(i, j, k, 1) -
                     (dt6 / hz) *
@@ -1241,7 +1285,7 @@ void Maestro::VelPredTransverse(
                         (uimhz(i, j, k + 1, 1) - uimhz(i, j, k, 1));
 
         // impose lo side bc's
-        if (i == domlo[0]) {
+        if (lo_bc && i == domlo[0]) {
             switch (physbc[0]) {
                 case Inflow:
                     vlxz = utilde(i - 1, j, k, 1);
@@ -1261,7 +1305,7 @@ void Maestro::VelPredTransverse(
             }
 
             // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
+        } else if (hi_bc && i == domhi[0] + 1) {
             switch (physbc[AMREX_SPACEDIM]) {
                 case Inflow:
                     vlxz = utilde(i, j, k, 1);
@@ -1286,13 +1330,19 @@ void Maestro::VelPredTransverse(
         vimhxz(i, j, k) = amrex::Math::abs(utrans(i, j, k)) < rel_eps_local
                               ? 0.5 * (vlxz + vrxz)
                               : vimhxz(i, j, k);
-    });
+    };
+    maestro::ParallelForBC(imhbox, has_lo_bc, has_hi_bc, make_vimhxz);
 
     // vimhzx, 2, 3
     imhbox = amrex::grow(mfi.tilebox(), 1, 1);
     imhbox = amrex::growHi(imhbox, 2, 1);
 
-    ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[2] != Interior && imhbox.smallEnd(2) <= domlo[2];
+    has_hi_bc = physbc[AMREX_SPACEDIM + 2] != Interior &&
+                imhbox.bigEnd(2) >= domhi[2] + 1;
+
+    const auto make_vimhzx = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         // extrapolate to faces
         Real vlzx = ulz(i, j, k, 1) -
                     (dt6 / hx) *
@@ -1303,7 +1353,7 @@ void Maestro::VelPredTransverse(
                         (uimhx(i + 1, j, k, 1) - uimhx(i, j, k, 1));
 
         // impose lo side bc's
-        if (k == domlo[2]) {
+        if (lo_bc && k == domlo[2]) {
             switch (physbc[2]) {
                 case Inflow:
                     vlzx = utilde(i, j, k - 1, 1);
@@ -1323,7 +1373,7 @@ void Maestro::VelPredTransverse(
             }
 
             // impose hi side bc's
-        } else if (k == domhi[2] + 1) {
+        } else if (hi_bc && k == domhi[2] + 1) {
             switch (physbc[AMREX_SPACEDIM + 2]) {
                 case Inflow:
                     vlzx = utilde(i, j, k, 1);
@@ -1348,13 +1398,19 @@ void Maestro::VelPredTransverse(
         vimhzx(i, j, k) = amrex::Math::abs(wtrans(i, j, k)) < rel_eps_local
                               ? 0.5 * (vlzx + vrzx)
                               : vimhzx(i, j, k);
-    });
+    };
+    maestro::ParallelForBC(imhbox, has_lo_bc, has_hi_bc, make_vimhzx);
 
     // wimhxy, 3, 1
     imhbox = amrex::grow(mfi.tilebox(), 2, 1);
     imhbox = amrex::growHi(imhbox, 0, 1);
 
-    ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[0] != Interior && imhbox.smallEnd(0) <= domlo[0];
+    has_hi_bc = physbc[AMREX_SPACEDIM] != Interior &&
+                imhbox.bigEnd(0) >= domhi[0] + 1;
+
+    const auto make_wimhxy = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         // extrapolate to faces
         Real wlxy = ulx(i, j, k, 2) -
                     (dt6 / hy) *
@@ -1365,7 +1421,7 @@ void Maestro::VelPredTransverse(
                         (uimhy(i, j + 1, k, 2) - uimhy(i, j, k, 2));
 
         // impose lo side bc's
-        if (i == domlo[0]) {
+        if (lo_bc && i == domlo[0]) {
             switch (physbc[0]) {
                 case Inflow:
                     wlxy = utilde(i - 1, j, k, 2);
@@ -1385,7 +1441,7 @@ void Maestro::VelPredTransverse(
             }
 
             // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
+        } else if (hi_bc && i == domhi[0] + 1) {
             switch (physbc[AMREX_SPACEDIM]) {
                 case Inflow:
                     wlxy = utilde(i, j, k, 2);
@@ -1410,13 +1466,19 @@ void Maestro::VelPredTransverse(
         wimhxy(i, j, k) = amrex::Math::abs(utrans(i, j, k)) < rel_eps_local
                               ? 0.5 * (wlxy + wrxy)
                               : wimhxy(i, j, k);
-    });
+    };
+    maestro::ParallelForBC(imhbox, has_lo_bc, has_hi_bc, make_wimhxy);
 
     // wimhyx, 3, 2
     imhbox = amrex::grow(mfi.tilebox(), 2, 1);
     imhbox = amrex::growHi(imhbox, 1, 1);
 
-    ParallelFor(imhbox, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[1] != Interior && imhbox.smallEnd(1) <= domlo[1];
+    has_hi_bc = physbc[AMREX_SPACEDIM + 1] != Interior &&
+                imhbox.bigEnd(1) >= domhi[1] + 1;
+
+    const auto make_wimhyx = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                  auto lo_bc, auto hi_bc) {
         // extrapolate to faces
         Real wlyx = uly(i, j, k, 2) -
                     (dt6 / hx) *
@@ -1427,7 +1489,7 @@ void Maestro::VelPredTransverse(
                         (uimhx(i + 1, j, k, 2) - uimhx(i, j, k, 2));
 
         // impose lo side bc's
-        if (j == domlo[1]) {
+        if (lo_bc && j == domlo[1]) {
             switch (physbc[1]) {
                 case Inflow:
                     wlyx = utilde(i, j - 1, k, 2);
@@ -1447,7 +1509,7 @@ void Maestro::VelPredTransverse(
             }
 
             // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
+        } else if (hi_bc && j == domhi[1] + 1) {
             switch (physbc[AMREX_SPACEDIM + 1]) {
                 case Inflow:
                     wlyx = utilde(i, j, k, 2);
@@ -1472,7 +1534,8 @@ void Maestro::VelPredTransverse(
         wimhyx(i, j, k) = amrex::Math::abs(vtrans(i, j, k)) < rel_eps_local
                               ? 0.5 * (wlyx + wryx)
                               : wimhyx(i, j, k);
-    });
+    };
+    maestro::ParallelForBC(imhbox, has_lo_bc, has_hi_bc, make_wimhyx);
 }
 
 void Maestro::VelPredVelocities(
@@ -1522,7 +1585,14 @@ void Maestro::VelPredVelocities(
     }
 
     // x-direction
-    ParallelFor(xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    // only boxes that reach a physical boundary need the boundary
+    // conditions imposed on the faces
+    bool has_lo_bc = physbc[0] != Interior && xbx.smallEnd(0) <= domlo[0];
+    bool has_hi_bc = physbc[AMREX_SPACEDIM] != Interior &&
+                     xbx.bigEnd(0) >= domhi[0] + 1;
+
+    const auto velocity_x = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
         // use the traced force if ppm_trace_forces = 1
         Real fl = ppm_trace_forces == 0 ? force(i - 1, j, k, 0)
                                         : Ipfx(i - 1, j, k, 0);
@@ -1562,7 +1632,7 @@ void Maestro::VelPredVelocities(
         }
 
         // impose lo side bc's
-        if (i == domlo[0]) {
+        if (lo_bc && i == domlo[0]) {
             switch (physbc[0]) {
                 case Inflow:
                     umac(i, j, k) = utilde(i - 1, j, k, 0);
@@ -1580,7 +1650,7 @@ void Maestro::VelPredVelocities(
             }
 
             // impose hi side bc's
-        } else if (i == domhi[0] + 1) {
+        } else if (hi_bc && i == domhi[0] + 1) {
             switch (physbc[AMREX_SPACEDIM]) {
                 case Inflow:
                     umac(i, j, k) = utilde(i, j, k, 0);
@@ -1597,10 +1667,16 @@ void Maestro::VelPredVelocities(
                     break;
             }
         }
-    });
+    };
+    maestro::ParallelForBC(xbx, has_lo_bc, has_hi_bc, velocity_x);
 
     // y-direction
-    ParallelFor(ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[1] != Interior && ybx.smallEnd(1) <= domlo[1];
+    has_hi_bc = physbc[AMREX_SPACEDIM + 1] != Interior &&
+                ybx.bigEnd(1) >= domhi[1] + 1;
+
+    const auto velocity_y = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
         // use the traced force if ppm_trace_forces = 1
         Real fl = ppm_trace_forces == 0 ? force(i, j - 1, k, 1)
                                         : Ipfy(i, j - 1, k, 1);
@@ -1640,7 +1716,7 @@ void Maestro::VelPredVelocities(
         }
 
         // impose lo side bc's
-        if (j == domlo[1]) {
+        if (lo_bc && j == domlo[1]) {
             switch (physbc[1]) {
                 case Inflow:
                     vmac(i, j, k) = utilde(i, j - 1, k, 1);
@@ -1658,7 +1734,7 @@ void Maestro::VelPredVelocities(
             }
 
             // impose hi side bc's
-        } else if (j == domhi[1] + 1) {
+        } else if (hi_bc && j == domhi[1] + 1) {
             switch (physbc[AMREX_SPACEDIM + 1]) {
                 case Inflow:
                     vmac(i, j, k) = utilde(i, j, k, 1);
@@ -1675,10 +1751,16 @@ void Maestro::VelPredVelocities(
                     break;
             }
         }
-    });
+    };
+    maestro::ParallelForBC(ybx, has_lo_bc, has_hi_bc, velocity_y);
 
     // z-direction
-    ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+    has_lo_bc = physbc[2] != Interior && zbx.smallEnd(2) <= domlo[2];
+    has_hi_bc = physbc[AMREX_SPACEDIM + 2] != Interior &&
+                zbx.bigEnd(2) >= domhi[2] + 1;
+
+    const auto velocity_z = [=] AMREX_GPU_DEVICE(int i, int j, int k,
+                                                 auto lo_bc, auto hi_bc) {
         // use the traced force if ppm_trace_forces = 1
         Real fl = ppm_trace_forces == 0 ? force(i, j, k - 1, 2)
                                         : Ipfz(i, j, k - 1, 2);
@@ -1728,7 +1810,7 @@ void Maestro::VelPredVelocities(
         }
 
         // impose hi side bc's
-        if (k == domlo[2]) {
+        if (lo_bc && k == domlo[2]) {
             switch (physbc[2]) {
                 case Inflow:
                     wmac(i, j, k) = utilde(i, j, k - 1, 2);
@@ -1746,7 +1828,7 @@ void Maestro::VelPredVelocities(
             }
 
             // impose lo side bc's
-        } else if (k == domhi[2] + 1) {
+        } else if (hi_bc && k == domhi[2] + 1) {
             switch (physbc[AMREX_SPACEDIM + 2]) {
                 case Inflow:
                     wmac(i, j, k) = utilde(i, j, k, 2);
@@ -1763,7 +1845,8 @@ void Maestro::VelPredVelocities(
                     break;
             }
         }
-    });
+    };
+    maestro::ParallelForBC(zbx, has_lo_bc, has_hi_bc, velocity_z);
 }
 
 #endif
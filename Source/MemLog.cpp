@@ -0,0 +1,141 @@
+#include <MemLog.H>
+
+#include <AMReX_BLProfiler.H>
+#include <AMReX_BaseFab.H>
+#include <AMReX_FabArrayBase.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+#include <AMReX_Utility.H>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+using namespace amrex;
+
+namespace {
+
+const std::array<std::string, MemLog::num_phases> phase_names = {
+    "other", "regrid",    "predictor", "macproj", "advance",   "thermal",
+    "react", "nodalproj", "diag",      "plot",    "checkpoint"};
+
+}  // namespace
+
+void MemLog::beginStep(const int step_in) {
+    step = step_in;
+    active = true;
+
+    visited.fill(false);
+    live.fill(0);
+    peak.fill(0);
+    builds.fill(0);
+
+    current = other;
+    ResetTotalBytesAllocatedInFabsHWM();
+    phase_start_builds = FabArrayBase::m_FA_stats.num_build;
+}
+
+void MemLog::beginPhase(const Phase phase) {
+    if (!active) {
+        return;
+    }
+
+    closePhase();
+
+    current = phase;
+    ResetTotalBytesAllocatedInFabsHWM();
+    phase_start_builds = FabArrayBase::m_FA_stats.num_build;
+}
+
+void MemLog::closePhase() {
+    visited[current] = true;
+    live[current] = TotalBytesAllocatedInFabs();
+    peak[current] = std::max(peak[current], TotalBytesAllocatedInFabsHWM());
+    builds[current] +=
+        FabArrayBase::m_FA_stats.num_build - phase_start_builds;
+}
+
+void MemLog::endStep(const std::string& filename) {
+    if (!active) {
+        return;
+    }
+
+    // timer for profiling
+    BL_PROFILE("MemLog::endStep()");
+
+    closePhase();
+    active = false;
+
+    // max over ranks of live, peak, and builds, and the sum of live, all
+    // in one reduction each
+    std::array<Long, 3 * num_phases> maxes;
+    std::array<Long, num_phases> live_sum = live;
+    for (int n = 0; n < num_phases; ++n) {
+        maxes[n] = live[n];
+        maxes[num_phases + n] = peak[n];
+        maxes[2 * num_phases + n] = builds[n];
+    }
+
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    ParallelDescriptor::ReduceLongMax(maxes.data(), 3 * num_phases, ioproc);
+    ParallelDescriptor::ReduceLongSum(live_sum.data(), num_phases, ioproc);
+
+    if (!ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    ++nsteps;
+
+    std::ofstream File;
+    if (!header_written) {
+        const bool is_new = !FileExists(filename);
+        File.open(filename, std::ofstream::out | std::ofstream::app);
+        if (is_new) {
+            File << "step,phase,live_bytes_max,live_bytes_avg,"
+                 << "peak_bytes_max,fabarrays_built_max\n";
+        }
+        header_written = true;
+    } else {
+        File.open(filename, std::ofstream::out | std::ofstream::app);
+    }
+    if (!File.good()) {
+        FileOpenFailed(filename);
+    }
+
+    const int nprocs = ParallelDescriptor::NProcs();
+    for (int n = 0; n < num_phases; ++n) {
+        if (!visited[n]) {
+            continue;
+        }
+
+        File << step << "," << phase_names[n] << "," << maxes[n] << ","
+             << live_sum[n] / nprocs << "," << maxes[num_phases + n] << ","
+             << maxes[2 * num_phases + n] << "\n";
+
+        peak_max[n] = std::max(peak_max[n], maxes[num_phases + n]);
+        builds_total[n] += maxes[2 * num_phases + n];
+    }
+}
+
+void MemLog::printSummary() const {
+    if (nsteps == 0) {
+        return;
+    }
+
+    const Real MB = 1024.0 * 1024.0;
+
+    Print() << "\nFAB memory per rank over " << nsteps
+            << " steps (max over ranks):\n";
+    Print() << std::setw(12) << std::left << "phase" << std::setw(16)
+            << std::right << "peak (MB)" << std::setw(20)
+            << "FabArrays/step" << "\n";
+    for (int n = 0; n < num_phases; ++n) {
+        if (builds_total[n] == 0 && peak_max[n] == 0) {
+            continue;
+        }
+        Print() << std::setw(12) << std::left << phase_names[n]
+                << std::setw(16) << std::right << std::fixed
+                << std::setprecision(1) << Real(peak_max[n]) / MB
+                << std::setw(20) << Real(builds_total[n]) / nsteps << "\n";
+    }
+    Print() << std::endl;
+}
@@ -0,0 +1,44 @@
+#include <MultiFabPool.H>
+#include <algorithm>
+
+using namespace amrex;
+
+MultiFabPool::Scope::Scope(MultiFabPool& pool_in, const int generation)
+    : pool(pool_in) {
+    if (pool.generation != generation) {
+        pool.clear();
+        pool.generation = generation;
+    }
+}
+
+MultiFabPool::Scope::~Scope() {
+    for (auto* mf : checked_out) {
+        if (mf->ok()) {
+            pool.free_list.push_back(
+                std::make_unique<MultiFab>(std::move(*mf)));
+        }
+    }
+}
+
+void MultiFabPool::Scope::define(MultiFab& mf, const BoxArray& ba,
+                                 const DistributionMapping& dm,
+                                 const int ncomp, const int ngrow) {
+    AMREX_ASSERT(std::find(checked_out.begin(), checked_out.end(), &mf) ==
+                 checked_out.end());
+
+    auto& free_list = pool.free_list;
+
+    for (auto it = free_list.begin(); it != free_list.end(); ++it) {
+        const MultiFab& pooled = **it;
+        if (pooled.nComp() == ncomp && pooled.nGrowVect() == IntVect(ngrow) &&
+            pooled.boxArray() == ba && pooled.DistributionMap() == dm) {
+            mf = std::move(**it);
+            free_list.erase(it);
+            checked_out.push_back(&mf);
+            return;
+        }
+    }
+
+    mf.define(ba, dm, ncomp, ngrow);
+    checked_out.push_back(&mf);
+}
@@ -0,0 +1,76 @@
+#include <PhaseTimer.H>
+
+#include <AMReX_BLProfiler.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Utility.H>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+using namespace amrex;
+
+namespace {
+
+const std::array<std::string, PhaseTimer::num_timers> timer_names = {
+    "step",    "macproj", "nodalproj", "react",
+    "thermal", "edgescal", "average",  "put1d"};
+
+}  // namespace
+
+PhaseTimer::Scope::Scope(PhaseTimer& timer, const Timer t)
+    : pt(timer), which(t) {
+    if (pt.depth[which]++ == 0) {
+        start = ParallelDescriptor::second();
+    }
+}
+
+PhaseTimer::Scope::~Scope() {
+    if (--pt.depth[which] == 0) {
+        pt.elapsed[which] += ParallelDescriptor::second() - start;
+    }
+}
+
+void PhaseTimer::endStep(const std::string& filename, const int nstep,
+                         const Real time, const Real dt) {
+    // timer for profiling
+    BL_PROFILE("PhaseTimer::endStep()");
+
+    std::array<Real, num_timers> tmin = elapsed;
+    std::array<Real, num_timers> tsum = elapsed;
+    std::array<Real, num_timers> tmax = elapsed;
+    elapsed.fill(0.0);
+
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    ParallelDescriptor::ReduceRealMin(tmin.data(), num_timers, ioproc);
+    ParallelDescriptor::ReduceRealSum(tsum.data(), num_timers, ioproc);
+    ParallelDescriptor::ReduceRealMax(tmax.data(), num_timers, ioproc);
+
+    if (!ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    std::ofstream File;
+    const bool write_header = !header_written && !FileExists(filename);
+    File.open(filename, std::ofstream::out | std::ofstream::app);
+    if (!File.good()) {
+        FileOpenFailed(filename);
+    }
+    header_written = true;
+
+    if (write_header) {
+        File << "step,time,dt";
+        for (const auto& name : timer_names) {
+            File << "," << name << "_min," << name << "_avg," << name
+                 << "_max";
+        }
+        File << "\n";
+    }
+
+    const int nprocs = ParallelDescriptor::NProcs();
+    File << std::setprecision(std::numeric_limits<Real>::digits10) << nstep
+         << "," << time << "," << dt << std::setprecision(6);
+    for (int n = 0; n < num_timers; ++n) {
+        File << "," << tmin[n] << "," << tsum[n] / nprocs << "," << tmax[n];
+    }
+    File << "\n";
+}
@@ -7,6 +7,45 @@ using namespace amrex;
 
 std::string inputs_name;
 
+// called by amrex::Initialize after the inputs file is read.
+// maestro.async_io turns on AMReX's asynchronous output, which writes
+// plotfiles and checkpoints from a background thread.
+void add_async_out() {
+    ParmParse pp("maestro");
+    bool async_io = false;
+    pp.query("async_io", async_io);
+
+    ParmParse pp_amrex("amrex");
+    if (!async_io || pp_amrex.contains("async_out")) {
+        return;
+    }
+
+#ifdef AMREX_USE_MPI
+    // unless MPI provides MPI_THREAD_MULTIPLE, AsyncOut aborts if there are
+    // more ranks than amrex.async_out_nfiles (64 by default), so each rank
+    // has to write its own file
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    const int nprocs = ParallelDescriptor::NProcs();
+    if (provided < MPI_THREAD_MULTIPLE) {
+        int nfiles = 64;
+        if (!pp_amrex.query("async_out_nfiles", nfiles)) {
+            nfiles = amrex::max(nfiles, nprocs);
+            pp_amrex.add("async_out_nfiles", nfiles);
+        }
+        if (nfiles < nprocs) {
+            Print() << "maestro.async_io: amrex.async_out_nfiles = " << nfiles
+                    << " is less than the " << nprocs
+                    << " ranks and MPI_THREAD_MULTIPLE is not available,"
+                    << " writing output synchronously" << std::endl;
+            return;
+        }
+    }
+#endif
+
+    pp_amrex.add("async_out", 1);
+}
+
 int main(int argc, char* argv[]) {
     // check to see if it contains --describe
     if (argc >= 2) {
@@ -19,7 +58,7 @@ int main(int argc, char* argv[]) {
     }
 
     // in AMReX.cpp
-    Initialize(argc, argv);
+    Initialize(argc, argv, true, MPI_COMM_WORLD, add_async_out);
 
     // Refuse to continue if we did not provide an inputs file.
 
@@ -1,12 +1,100 @@
 #include <ModelParser.H>
+
+#include <AMReX_ParallelDescriptor.H>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 
 using namespace amrex;
 
-void ModelParser::ReadFile(const std::string& model_file_name) {
+namespace {
+
+// first line of a binary model file
+const std::string binary_magic = "MAESTROeX binary model 2";
+
+// 64-bit FNV-1a hash of the bytes of a file, used to tie a binary model
+// to the contents of the text model it was made from (0 if the file
+// cannot be read)
+std::uint64_t FileChecksum(const std::string& file_name) {
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file.is_open()) {
+        return 0;
+    }
+
+    std::uint64_t hash = 14695981039346656037ULL;
+    char buffer[65536];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        const auto n = file.gcount();
+        for (std::streamsize i = 0; i < n; ++i) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+}  // namespace
+
+std::string ModelParser::VarName(const int ivar) {
+    if (ivar == idens_model) {
+        return "density";
+    } else if (ivar == itemp_model) {
+        return "temperature";
+    } else if (ivar == ipres_model) {
+        return "pressure";
+    }
+    return maestro::trim(spec_names_cxx[ivar - ispec_model]);
+}
+
+void ModelParser::ReadFile(const std::string& model_file_name,
+                           const std::string& binary_file_name) {
+    Print() << "model file = " << model_file_name << std::endl;
+
+    // only the I/O processor reads the model files, the other ranks get
+    // the model through a broadcast
+    if (ParallelDescriptor::IOProcessor()) {
+        // the checksum of the text model, so that a binary model made from
+        // an older version of it is not used
+        const std::uint64_t checksum =
+            binary_file_name.empty() ? 0 : FileChecksum(model_file_name);
+
+        if (binary_file_name.empty() ||
+            !ReadBinaryFile(binary_file_name, model_file_name, checksum)) {
+            ReadAsciiFile(model_file_name);
+
+            if (!binary_file_name.empty()) {
+                WriteBinaryFile(binary_file_name, model_file_name, checksum);
+            }
+        }
+    }
+
+    BcastModel();
+
+    model_initialized = true;
+}
+
+void ModelParser::BcastModel() {
+    const int root = ParallelDescriptor::IOProcessorNumber();
+
+    ParallelDescriptor::Bcast(&npts_model, 1, root);
+
+    model_r.resize(npts_model);
+    ParallelDescriptor::Bcast(model_r.dataPtr(), npts_model, root);
+
+    model_state.resize(nvars_model);
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        model_state[ivar].resize(npts_model);
+        ParallelDescriptor::Bcast(model_state[ivar].dataPtr(), npts_model,
+                                  root);
+    }
+}
+
+void ModelParser::ReadAsciiFile(const std::string& model_file_name) {
     // open the model file
     std::ifstream model_file(model_file_name);
-    Print() << "model file = " << model_file_name << std::endl;
 
     if (!model_file.is_open()) {
         Abort("Could not open model file!");
@@ -21,22 +109,46 @@ void ModelParser::ReadFile(const std::string& model_file_name) {
     // now read in the number of variables
     std::getline(model_file, line);
     ipos = line.find('=') + 1;
-    static const int nvars_model_file = std::stoi(line.substr(ipos));
+    const int nvars_model_file = std::stoi(line.substr(ipos));
 
-    RealVector vars_stored(nvars_model_file);
-    std::vector<std::string> varnames_stored(nvars_model_file);
+    // now read in the names of the variables, and find the model variable
+    // (if any) that each column of the file holds
+    Vector<int> model_var(nvars_model_file, -1);
+    Vector<bool> found(nvars_model, false);
 
-    // now read in the names of the variables
-    for (auto i = 0; i < nvars_model_file; ++i) {
+    for (auto j = 0; j < nvars_model_file; ++j) {
         std::getline(model_file, line);
         ipos = line.find('#') + 1;
-        varnames_stored[i] = maestro::trim(line.substr(ipos));
+        const std::string varname = maestro::trim(line.substr(ipos));
+
+        for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+            if (varname == VarName(ivar)) {
+                model_var[j] = ivar;
+                found[ivar] = true;
+            }
+        }
+
+        // is the current variable from the model file one that we
+        // care about?
+        if (model_var[j] < 0) {
+            Print() << "WARNING: variable not found: " << varname
+                    << std::endl;
+        }
+    }
+
+    // were all the variable that we care about provided?
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        if (!found[ivar]) {
+            Print() << "WARNING: " << VarName(ivar)
+                    << " not provided in inputs file" << std::endl;
+        }
     }
 
     // alocate storage for the model data
-    model_state.resize(npts_model);
-    for (auto i = 0; i < npts_model; ++i) {
-        model_state[i].resize(nvars_model);
+    model_state.resize(nvars_model);
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        model_state[ivar].resize(npts_model);
+        std::fill(model_state[ivar].begin(), model_state[ivar].end(), 0.0);
     }
     model_r.resize(npts_model);
 
@@ -48,102 +160,136 @@ void ModelParser::ReadFile(const std::string& model_file_name) {
     // start reading in the data
     for (auto i = 0; i < npts_model; ++i) {
         std::getline(model_file, line);
-        std::istringstream iss(line);
-        iss >> model_r[i];
-        for (auto j = 0; j < nvars_model_file; ++j) {
-            iss >> vars_stored[j];
-        }
 
-        for (auto j = 0; j < nvars_model; ++j) {
-            model_state[i][j] = 0.0;
-        }
-
-        // make sure that each of the variables that MAESTROeX cares about
-        // are found
-        bool found_dens = false;
-        bool found_temp = false;
-        bool found_pres = false;
-        std::vector<bool> found_spec(NumSpec);
-        for (auto comp = 0; comp < NumSpec; ++comp) {
-            found_spec[comp] = false;
-        }
+        const char* pos = line.c_str();
+        char* end = nullptr;
 
+        model_r[i] = std::strtod(pos, &end);
         for (auto j = 0; j < nvars_model_file; ++j) {
-            // keep track of whether the current variable from the model
-            // file is the one that MAESTROeX cares about
-
-            bool found_model = false;
-
-            if (varnames_stored[j] == "density") {
-                model_state[i][idens_model] = vars_stored[j];
-                found_model = true;
-                found_dens = true;
-            } else if (varnames_stored[j] == "temperature") {
-                model_state[i][itemp_model] = vars_stored[j];
-                found_model = true;
-                found_temp = true;
-            } else if (varnames_stored[j] == "pressure") {
-                model_state[i][ipres_model] = vars_stored[j];
-                found_model = true;
-                found_pres = true;
-            } else {
-                for (auto comp = 0; comp < NumSpec; ++comp) {
-                    if (varnames_stored[j] == spec_names_cxx[comp]) {
-                        model_state[i][ispec_model + comp] = vars_stored[j];
-                        found_model = true;
-                        found_spec[comp] = true;
-                    }
-                }
+            pos = end;
+            const Real val = std::strtod(pos, &end);
+            if (end == pos) {
+                Abort("ModelParser: too few values on line " +
+                      std::to_string(i + 1) + " of the model data");
             }
-
-            // is the current variable from the model file one that we
-            // care about?
-            if (!found_model && i == 0) {
-                Print() << "WARNING: variable not found: "
-                        << maestro::trim(varnames_stored[j]) << std::endl;
+            if (model_var[j] >= 0) {
+                model_state[model_var[j]][i] = val;
             }
         }
+    }
+}
 
-        // were all the variable that we care about provided?
-        if (i == 0) {
-            if (!found_dens) {
-                Print() << "WARNING: density not provided in inputs file"
-                        << std::endl;
-            }
-            if (!found_temp) {
-                Print() << "WARNING: temperature not provided in inputs file"
-                        << std::endl;
-            }
-            if (!found_pres) {
-                Print() << "WARNING: pressure not provided in inputs file"
-                        << std::endl;
-            }
-            for (auto comp = 0; comp < NumSpec; ++comp) {
-                if (!found_spec[comp]) {
-                    Print()
-                        << "WARNING: " << maestro::trim(spec_names_cxx[comp])
-                        << " not provided in inputs file" << std::endl;
-                }
-            }
-        }
+bool ModelParser::ReadBinaryFile(const std::string& binary_file_name,
+                                 const std::string& model_file_name,
+                                 const std::uint64_t checksum) {
+    std::ifstream binary_file(binary_file_name, std::ios::binary);
+
+    if (!binary_file.is_open()) {
+        return false;
     }
 
-    model_initialized = true;
+    // make sure the binary file was made from the same model, with the
+    // same contents, for the same variables, at the same precision
+    std::string line;
+    std::getline(binary_file, line);
+    bool match = line == binary_magic;
+
+    std::getline(binary_file, line);
+    match = match && line == model_file_name;
+
+    int npts = 0;
+    int nvars = 0;
+    int real_size = 0;
+    std::uint64_t file_checksum = 0;
+    binary_file >> npts >> nvars >> real_size >> file_checksum;
+    std::getline(binary_file, line);
+    match = match && npts > 0 && nvars == nvars_model &&
+            real_size == int(sizeof(Real)) && file_checksum == checksum;
+
+    for (auto ivar = 0; match && ivar < nvars_model; ++ivar) {
+        std::getline(binary_file, line);
+        match = line == VarName(ivar);
+    }
+
+    if (!match) {
+        Print() << "binary model file " << binary_file_name
+                << " does not match the model, it will be rewritten"
+                << std::endl;
+        return false;
+    }
+
+    npts_model = npts;
+    model_r.resize(npts_model);
+    binary_file.read(reinterpret_cast<char*>(model_r.dataPtr()),
+                     npts_model * sizeof(Real));
+
+    model_state.resize(nvars_model);
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        model_state[ivar].resize(npts_model);
+        binary_file.read(
+            reinterpret_cast<char*>(model_state[ivar].dataPtr()),
+            npts_model * sizeof(Real));
+    }
+
+    if (!binary_file.good()) {
+        Abort("ModelParser: could not read binary model file " +
+              binary_file_name);
+    }
+
+    Print() << "\n\nread initial model from " << binary_file_name
+            << std::endl;
+    Print() << npts_model << " points found in the initial model" << std::endl;
+
+    return true;
 }
 
-Real ModelParser::Interpolate(const Real r, const int ivar,
-                              bool interpolate_top) {
-    // use the module's array of model coordinates (model_r), and
-    // variables (model_state), to find the value of model_var at point
-    // r using linear interpolation.
+void ModelParser::WriteBinaryFile(const std::string& binary_file_name,
+                                  const std::string& model_file_name,
+                                  const std::uint64_t checksum) const {
+    // write to a temporary file first, so that a run that dies while
+    // writing does not leave behind a truncated model
+    const std::string tmp_file_name = binary_file_name + ".tmp";
+    std::ofstream binary_file(tmp_file_name, std::ios::binary);
 
-    Real interpolate = 0.0;
+    if (!binary_file.is_open()) {
+        Print() << "WARNING: could not write binary model file "
+                << binary_file_name << std::endl;
+        return;
+    }
+
+    binary_file << binary_magic << "\n"
+                << model_file_name << "\n"
+                << npts_model << " " << nvars_model << " " << sizeof(Real)
+                << " " << checksum << "\n";
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        binary_file << VarName(ivar) << "\n";
+    }
+
+    binary_file.write(reinterpret_cast<const char*>(model_r.dataPtr()),
+                      npts_model * sizeof(Real));
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        binary_file.write(
+            reinterpret_cast<const char*>(model_state[ivar].dataPtr()),
+            npts_model * sizeof(Real));
+    }
+    binary_file.close();
 
-    // find the location in the coordinate array where we want to interpolate
-    int i = 0;
-    while (model_r[i] < r && i <= npts_model) {
-        i++;
+    if (!binary_file.good() ||
+        std::rename(tmp_file_name.c_str(), binary_file_name.c_str()) != 0) {
+        Print() << "WARNING: could not write binary model file "
+                << binary_file_name << std::endl;
+        return;
     }
+
+    Print() << "wrote binary model file " << binary_file_name << std::endl;
+}
+
+int ModelParser::FindIndex(const Real r) const {
+    // find the location in the coordinate array where we want to
+    // interpolate: the first point at or above r, or the closer point
+    // below it
+    int i = std::lower_bound(model_r.begin(), model_r.end(), r) -
+            model_r.begin();
     if (i > 0 && i < npts_model) {
         if (amrex::Math::abs(r - model_r[i - 1]) <
             amrex::Math::abs(r - model_r[i])) {
@@ -152,56 +298,74 @@ Real ModelParser::Interpolate(const Real r, const int ivar,
     } else if (i == npts_model) {
         i--;
     }
+    return i;
+}
+
+Real ModelParser::Interpolate(const Real r, const int ivar,
+                              bool interpolate_top) {
+    // use the module's array of model coordinates (model_r), and
+    // variables (model_state), to find the value of model_var at point
+    // r using linear interpolation.
+    return InterpolateAt(FindIndex(r), r, ivar, interpolate_top);
+}
+
+void ModelParser::Interpolate(const Real r, Array<Real, nvars_model>& vars,
+                              bool interpolate_top) {
+    const int i = FindIndex(r);
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        vars[ivar] = InterpolateAt(i, r, ivar, interpolate_top);
+    }
+}
+
+Real ModelParser::InterpolateAt(const int i, const Real r, const int ivar,
+                                bool interpolate_top) const {
+    const auto& var = model_state[ivar];
+
+    Real interpolate = 0.0;
 
     if (i == 0) {
-        Real slope = (model_state[i + 1][ivar] - model_state[i][ivar]) /
-                     (model_r[i + 1] - model_r[i]);
-        interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+        Real slope = (var[i + 1] - var[i]) / (model_r[i + 1] - model_r[i]);
+        interpolate = slope * (r - model_r[i]) + var[i];
 
         // safety check to make sure interpolate lies within the bounding points
-        Real minvar =
-            amrex::min(model_state[i + 1][ivar], model_state[i][ivar]);
-        Real maxvar = max(model_state[i + 1][ivar], model_state[i][ivar]);
+        Real minvar = amrex::min(var[i + 1], var[i]);
+        Real maxvar = max(var[i + 1], var[i]);
         interpolate = max(interpolate, minvar);
         interpolate = amrex::min(interpolate, maxvar);
     } else if (i == npts_model - 1) {
-        Real slope = (model_state[i][ivar] - model_state[i - 1][ivar]) /
-                     (model_r[i] - model_r[i - 1]);
-        interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+        Real slope = (var[i] - var[i - 1]) / (model_r[i] - model_r[i - 1]);
+        interpolate = slope * (r - model_r[i]) + var[i];
 
         // safety check to make sure interpolate lies within the bounding points
         if (!interpolate_top) {
-            Real minvar =
-                amrex::min(model_state[i][ivar], model_state[i - 1][ivar]);
-            Real maxvar = max(model_state[i][ivar], model_state[i - 1][ivar]);
+            Real minvar = amrex::min(var[i], var[i - 1]);
+            Real maxvar = max(var[i], var[i - 1]);
             interpolate = max(interpolate, minvar);
             interpolate = amrex::min(interpolate, maxvar);
         }
     } else {
         if (r >= model_r[i]) {
-            Real slope = (model_state[i + 1][ivar] - model_state[i][ivar]) /
-                         (model_r[i + 1] - model_r[i]);
-            interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+            Real slope =
+                (var[i + 1] - var[i]) / (model_r[i + 1] - model_r[i]);
+            interpolate = slope * (r - model_r[i]) + var[i];
 
             // safety check to make sure interpolate lies within the bounding points
-            Real minvar =
-                amrex::min(model_state[i + 1][ivar], model_state[i][ivar]);
-            Real maxvar = max(model_state[i + 1][ivar], model_state[i][ivar]);
+            Real minvar = amrex::min(var[i + 1], var[i]);
+            Real maxvar = max(var[i + 1], var[i]);
             interpolate = max(interpolate, minvar);
             interpolate = amrex::min(interpolate, maxvar);
         } else {
-            Real slope = (model_state[i][ivar] - model_state[i - 1][ivar]) /
-                         (model_r[i] - model_r[i - 1]);
-            interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+            Real slope =
+                (var[i] - var[i - 1]) / (model_r[i] - model_r[i - 1]);
+            interpolate = slope * (r - model_r[i]) + var[i];
 
             // safety check to make sure interpolate lies within the bounding points
-            Real minvar =
-                amrex::min(model_state[i][ivar], model_state[i - 1][ivar]);
-            Real maxvar = max(model_state[i][ivar], model_state[i - 1][ivar]);
+            Real minvar = amrex::min(var[i], var[i - 1]);
+            Real maxvar = max(var[i], var[i - 1]);
             interpolate = max(interpolate, minvar);
             interpolate = amrex::min(interpolate, maxvar);
         }
     }
 
     return interpolate;
-}
\ No newline at end of file
+}